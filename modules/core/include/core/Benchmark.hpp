@@ -0,0 +1,100 @@
+/**
+ * @file Benchmark.hpp
+ * @brief Modo benchmark determinista: recorrido scriptado y reporte JSON
+ *
+ * El modo benchmark (--benchmark en la línea de comandos) fija la semilla,
+ * sustituye el teclado por un recorrido scriptado de la cámara/jugador con
+ * cambios de zoom y avanza la simulación con un deltaTime fijo. Así dos
+ * ejecuciones con la misma semilla y la misma cantidad de frames procesan
+ * la misma carga de trabajo.
+ *
+ * Al terminar se escribe un JSON con percentiles de tiempo de frame,
+ * throughput de generación de chunks, frames con huecos en la región
+ * visible y memoria pico.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * @struct BenchmarkInput
+ * @brief Input simulado de un frame (equivalente a las teclas WASD y +/-)
+ */
+struct BenchmarkInput {
+    int moveX = 0;  ///< -1 = A (oeste), +1 = D (este)
+    int moveZ = 0;  ///< -1 = W (norte), +1 = S (sur)
+    int zoom = 0;   ///< -1 = alejar, +1 = acercar
+};
+
+/**
+ * @class BenchmarkScript
+ * @brief Recorrido scriptado por tramos
+ *
+ * Tramos (a 60 frames por segundo simulados):
+ * - Calentamiento quieto
+ * - Este, alejar zoom, sur, oeste acercando zoom, oeste, acercar zoom, norte
+ *
+ * El recorrido se repite cíclicamente si se piden más frames que su duración.
+ */
+class BenchmarkScript {
+public:
+    static constexpr float FIXED_DELTA_TIME = 1.0f / 60.0f;  ///< deltaTime fijo de la simulación
+
+    /**
+     * @brief Input del frame indicado
+     * @param frame Índice de frame (desde 0)
+     */
+    static BenchmarkInput getInput(int frame);
+
+    /**
+     * @brief Duración de una vuelta completa del recorrido (frames)
+     */
+    static int getLoopLength();
+};
+
+/**
+ * @struct BenchmarkResults
+ * @brief Mediciones de una ejecución del benchmark
+ */
+struct BenchmarkResults {
+    uint32_t seed = 0;                 ///< Semilla del mundo
+    bool headless = false;             ///< Ventana oculta
+    double wallTimeSeconds = 0.0;      ///< Duración total de los frames medidos
+    std::vector<float> frameTimesMs;   ///< Tiempo real de cada frame (ms)
+    uint32_t chunksGenerated = 0;      ///< Chunks generados durante la ejecución
+    double generationMs = 0.0;         ///< Tiempo total de generación de esos chunks (ms)
+    size_t peakMemoryBytes = 0;        ///< Memoria residente pico del proceso
+    bool prefetch = true;              ///< Prefetch predictivo activo
+    uint32_t framesWithMissingChunks = 0;  ///< Frames con chunks visibles sin generar (huecos)
+    size_t chunkBudgetBytes = 0;       ///< Presupuesto de memoria de los chunks
+    size_t chunkResidentBytes = 0;     ///< Memoria de los chunks cargados al terminar
+    uint32_t chunksEvicted = 0;        ///< Chunks descargados por presupuesto durante la ejecución
+    size_t coldChunks = 0;             ///< Chunks en el tier frío al terminar
+    size_t coldBytes = 0;              ///< Memoria del tier frío al terminar
+    uint32_t chunksThawed = 0;         ///< Chunks expandidos del tier frío durante la ejecución
+    int startupChunks = 0;             ///< Chunks generados en la fase de carga (antes del primer frame)
+    double startupLoadMs = 0.0;        ///< Duración de la fase de carga (ms)
+    double timeToFirstFrameMs = 0.0;   ///< Desde init() hasta el primer frame con la vista completa (ms)
+};
+
+namespace Benchmark {
+
+/**
+ * @brief Memoria residente pico del proceso (bytes, 0 si no se puede medir)
+ *
+ * Windows: PeakWorkingSetSize. POSIX: ru_maxrss.
+ */
+size_t getPeakMemoryBytes();
+
+/**
+ * @brief Escribe los resultados como JSON
+ * @param results Resultados de la ejecución
+ * @param out Stream de salida
+ */
+void writeResultsJson(const BenchmarkResults& results, std::ostream& out);
+
+} // namespace Benchmark
@@ -161,3 +161,57 @@ namespace BlockConfig {
      * y costo de generar/renderizar cada chunk individual.
      */
 }
+
+/**
+ * @namespace RenderVariants
+ * @brief Variantes visuales por bloque elegidas en la generación
+ *
+ * OPTIMIZACIÓN: La variante de sprite (p.ej. cuál de los 24 árboles vivos)
+ * se decide UNA vez al generar el bloque y se guarda junto a él en el chunk.
+ * El renderer solo hace un lookup directo en su tabla de UVs por
+ * (tipo, variante), sin hash ni módulo por tile y por frame.
+ *
+ * Los bloques sin variantes usan siempre la variante 0.
+ */
+namespace RenderVariants {
+    constexpr uint8_t TREE_SECO_COUNT = 12;    ///< Árboles secos (fila 1 del sprite sheet de árboles)
+    constexpr uint8_t TREE_GRASS_COUNT = 24;   ///< Árboles vivos (filas 2-3)
+    constexpr uint8_t TREE_SANGRE_COUNT = 24;  ///< Árboles de sangre (filas 4-5)
+    constexpr uint8_t MAX_VARIANTS = 24;       ///< Máximo de variantes de cualquier tipo (tamaño de tabla)
+
+    /**
+     * @brief Cantidad de variantes visuales de un tipo de bloque
+     * @param type Tipo de bloque
+     * @return Número de variantes (1 si el tipo no tiene variantes)
+     */
+    inline uint8_t getVariantCount(BlockType type) {
+        switch (type) {
+            case BlockType::ARBOL_SECO:   return TREE_SECO_COUNT;
+            case BlockType::ARBOL_GRASS:  return TREE_GRASS_COUNT;
+            case BlockType::ARBOL_SANGRE: return TREE_SANGRE_COUNT;
+            default:                      return 1;
+        }
+    }
+
+    /**
+     * @brief Elige la variante de un bloque a partir de su posición mundial
+     * @param type Tipo de bloque
+     * @param worldX Coordenada X mundial
+     * @param worldZ Coordenada Z mundial
+     * @return Variante en [0, getVariantCount(type) - 1]
+     *
+     * Hash consistente por posición (el mismo que usaba el renderer), de modo
+     * que cada árbol conserva su sprite. La multiplicación se hace en 32 bits
+     * sin signo para evitar overflow con signo.
+     */
+    inline uint8_t fromPosition(BlockType type, int worldX, int worldZ) {
+        const uint8_t count = getVariantCount(type);
+        if (count <= 1) {
+            return 0;
+        }
+        int32_t mixed = static_cast<int32_t>(static_cast<uint32_t>(worldX) * 374761393u +
+                                             static_cast<uint32_t>(worldZ) * 668265263u);
+        int32_t hash = mixed % 1000000007;
+        return static_cast<uint8_t>((hash < 0 ? -hash : hash) % count);
+    }
+}
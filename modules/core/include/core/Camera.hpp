@@ -8,8 +8,8 @@
 
 #pragma once
 
-#include "Block.hpp"
-#include <SDL2/SDL.h>
+#include "core/Chunk.hpp"
+#include <vector>
 
 /**
  * @struct IsoConfig
@@ -187,6 +187,26 @@ public:
      */
     void setCenter(float centerX, float centerY);
 
+    /**
+     * @brief Calcula los chunks que pueden aparecer en pantalla
+     * @param screenWidth Ancho de la pantalla (píxeles)
+     * @param screenHeight Alto de la pantalla (píxeles)
+     * @param marginChunks Chunks extra alrededor de la vista (prefetch)
+     * @param maxRadius Radio máximo (Chebyshev) en chunks desde la cámara
+     * @param out Vector de salida (se limpia y se rellena, reutiliza capacidad)
+     *
+     * OPTIMIZACIÓN: Conjunto visible derivado del frustum en lugar de un cuadrado fijo.
+     * Proyecta inversamente las 4 esquinas de pantalla con screenToWorld() a la
+     * altura mínima (0) y máxima (WORLD_HEIGHT) del mundo. En isométrico la
+     * pantalla es un rectángulo alineado en el espacio u = x - z, v = x + z,
+     * por lo que el resultado es un "diamante" de chunks que depende del zoom
+     * y del tamaño de ventana:
+     * - zoom 5.0: pocos chunks (antes se pedían 11x11 siempre)
+     * - zoom 0.1: muchos chunks, limitados por maxRadius
+     */
+    void getVisibleChunks(int screenWidth, int screenHeight, int marginChunks, int maxRadius,
+                          std::vector<ChunkPos>& out) const;
+
 private:
     float m_posX;      ///< Coordenada X de la cámara en el mundo
     float m_posY;      ///< Coordenada Y de la cámara (altura)
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "core/Block.hpp"
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <memory>
@@ -165,6 +166,25 @@ struct BlockPos {
     }
 };
 
+/**
+ * @struct SurfaceColumn
+ * @brief Resumen de la superficie de una columna (x, z) de un chunk
+ *
+ * OPTIMIZACIÓN: LOD lejano por superficie.
+ * Lo rellena generateTerrain a la vez que el heightmap, de forma que el
+ * renderer puede dibujar chunks lejanos con un tile por columna sin
+ * recorrer el storage de bloques.
+ *
+ * - groundType/groundY: bloque de superficie del terreno (bioma)
+ * - topType/topVariant: decoración sobre la superficie en groundY + 1 (árbol) o AIRE
+ */
+struct SurfaceColumn {
+    BlockType groundType = BlockType::AIRE;  ///< Bloque de superficie (AIRE si la columna está vacía)
+    BlockType topType = BlockType::AIRE;     ///< Decoración en groundY + 1 (AIRE si no hay)
+    uint8_t groundY = 0;                     ///< Altura del bloque de superficie
+    uint8_t topVariant = 0;                  ///< Variante visual de la decoración
+};
+
 /**
  * @struct DenseBlockStorage
  * @brief Almacenamiento denso y compacto de bloques con índices de 16-bit
@@ -196,6 +216,7 @@ struct DenseBlockStorage {
 
     std::array<uint16_t, MAX_BLOCKS> m_blockIndices{};  ///< Índice a bloque denso o AIR_MARK (4KB fijos)
     std::vector<Block> m_denseBlocks;  ///< Array denso de solo bloques sólidos (contiguo en memoria)
+    std::vector<uint8_t> m_variants;   ///< Variante visual de cada bloque denso (paralelo a m_denseBlocks)
 
     /**
      * @brief Constructor - inicializa todos los bloques como AIRE
@@ -205,6 +226,7 @@ struct DenseBlockStorage {
         m_blockIndices.fill(AIR_MARK);
         // Reservar espacio típico para bloques sólidos (~600-800)
         m_denseBlocks.reserve(800);
+        m_variants.reserve(800);
     }
 
     /**
@@ -234,12 +256,23 @@ struct DenseBlockStorage {
         return m_denseBlocks[blockIdx];
     }
 
+    /**
+     * @brief Obtiene la variante visual de un bloque por índice
+     * @param index Índice del bloque [0, 2047]
+     * @return Variante (0 para aire o bloques sin variantes)
+     */
+    inline uint8_t getVariant(size_t index) const {
+        uint16_t blockIdx = m_blockIndices[index];
+        return blockIdx == AIR_MARK ? 0 : m_variants[blockIdx];
+    }
+
     /**
      * @brief Establece un bloque por índice
      * @param index Índice del bloque [0, 2047]
      * @param type Tipo de bloque
+     * @param variant Variante visual (ver RenderVariants), 0 por defecto
      */
-    inline void set(size_t index, BlockType type) {
+    inline void set(size_t index, BlockType type, uint8_t variant = 0) {
         if (type == BlockType::AIRE) {
             // Marcar como aire (no libera espacio en m_denseBlocks, pero podríamos implementar compactación)
             m_blockIndices[index] = AIR_MARK;
@@ -250,22 +283,43 @@ struct DenseBlockStorage {
                 // Nuevo bloque sólido - agregar al array denso
                 m_blockIndices[index] = static_cast<uint16_t>(m_denseBlocks.size());
                 m_denseBlocks.emplace_back(type);
+                m_variants.push_back(variant);
             } else {
                 // Bloque existente - solo actualizar tipo
                 m_denseBlocks[currentIdx] = Block(type);
+                m_variants[currentIdx] = variant;
             }
         }
     }
 
+    /**
+     * @brief Memoria de heap de los arrays densos (bytes, por capacidad)
+     */
+    inline size_t getHeapBytes() const {
+        return m_denseBlocks.capacity() * sizeof(Block) + m_variants.capacity() * sizeof(uint8_t);
+    }
+
     /**
      * @brief Limpia todo el almacenamiento
      */
     inline void clear() {
         m_blockIndices.fill(AIR_MARK);
         m_denseBlocks.clear();
+        m_variants.clear();
     }
 };
 
+/**
+ * @enum ChunkSide
+ * @brief Lados horizontales de un chunk (índice de vecino)
+ */
+enum class ChunkSide : uint8_t {
+    EAST = 0,   ///< X+
+    WEST = 1,   ///< X-
+    SOUTH = 2,  ///< Z+
+    NORTH = 3   ///< Z-
+};
+
 /**
  * @class Chunk
  * @brief Sección del mundo de 8x8x32 bloques
@@ -343,11 +397,14 @@ public:
      * @param y Coordenada Y (altura) [0, WORLD_HEIGHT-1]
      * @param z Coordenada Z local [0, CHUNK_SIZE-1]
      * @param type Tipo de bloque a establecer
+     * @param variant Variante visual (ver RenderVariants)
      *
      * Si las coordenadas están fuera de rango, la operación se ignora.
-     * Útil para modificar el terreno (colocar/quitar bloques).
+     * Útil para modificar el terreno (colocar/quitar bloques). No toca el
+     * heightmap ni la superficie: después de editar, refreshColumn() y
+     * updateHeightBounds().
      */
-    void setBlock(int x, int y, int z, BlockType type);
+    void setBlock(int x, int y, int z, BlockType type, uint8_t variant = 0);
 
     /**
      * @brief Obtiene bloque sin validación (versión unsafe)
@@ -395,6 +452,26 @@ public:
         m_blocks.set(index, type);
     }
 
+    /**
+     * @brief Establece bloque con variante visual sin validación
+     * @param x, y, z Coordenadas locales - DEBEN ser válidas
+     * @param type Tipo de bloque
+     * @param variant Variante visual elegida en generación (ver RenderVariants)
+     */
+    inline void setBlockUnsafe(int x, int y, int z, BlockType type, uint8_t variant) {
+        size_t index = getIndex(x, y, z);
+        m_blocks.set(index, type, variant);
+    }
+
+    /**
+     * @brief Obtiene la variante visual de un bloque sin validación
+     * @param x, y, z Coordenadas locales - DEBEN ser válidas
+     * @return Variante (0 para aire o bloques sin variantes)
+     */
+    inline uint8_t getVariantUnsafe(int x, int y, int z) const {
+        return m_blocks.getVariant(getIndex(x, y, z));
+    }
+
     /**
      * @brief Obtiene la posición del chunk en el mundo
      * @return ChunkPos con la posición del chunk
@@ -423,6 +500,19 @@ public:
      */
     void setGenerated(bool generated) { m_generated = generated; }
 
+    /**
+     * @brief Memoria que ocupa el chunk (objeto + arrays densos, en bytes)
+     *
+     * Es lo que World descuenta de su presupuesto de memoria.
+     */
+    size_t getResidentBytes() const { return sizeof(Chunk) + m_blocks.getHeapBytes(); }
+
+    /** @brief Reloj de uso del World en el último acceso (LRU) */
+    uint32_t getLastUsed() const { return m_lastUsed; }
+
+    /** @brief Registra un acceso con el reloj de uso del World (solo thread principal) */
+    void setLastUsed(uint32_t clock) { m_lastUsed = clock; }
+
     /**
      * @brief Obtiene la altura máxima sólida de una columna
      * @param x Coordenada X local [0, CHUNK_SIZE-1]
@@ -447,6 +537,93 @@ public:
         m_heightMap[index] = height;
     }
 
+    /**
+     * @brief Obtiene el resumen de superficie de una columna
+     * @param x Coordenada X local [0, CHUNK_SIZE-1]
+     * @param z Coordenada Z local [0, CHUNK_SIZE-1]
+     * @return Referencia al SurfaceColumn cacheado de la columna
+     *
+     * OPTIMIZACIÓN: Usado por el LOD lejano para emitir un tile por columna
+     * sin acceder a los bloques.
+     */
+    const SurfaceColumn& getSurface(int x, int z) const {
+        return m_surface[x + z * BlockConfig::CHUNK_SIZE];
+    }
+
+    /**
+     * @brief Obtiene el array completo de superficies (x + z*8)
+     * @return Referencia a las 64 columnas de superficie
+     */
+    const std::array<SurfaceColumn, 64>& getSurfaceColumns() const { return m_surface; }
+
+    /**
+     * @brief Establece el resumen de superficie de una columna (usado por generateTerrain)
+     * @param x Coordenada X local
+     * @param z Coordenada Z local
+     * @param surface Bloque de superficie, su altura y la decoración superior
+     */
+    void setSurface(int x, int z, const SurfaceColumn& surface) {
+        m_surface[x + z * BlockConfig::CHUNK_SIZE] = surface;
+    }
+
+    /**
+     * @brief Recalcula el heightmap y la superficie de una columna desde sus bloques
+     * @param x Coordenada X local [0, CHUNK_SIZE-1]
+     * @param z Coordenada Z local [0, CHUNK_SIZE-1]
+     *
+     * Para las ediciones (World::setBlock y los deltas guardados):
+     * generateTerrain los rellena directamente. Un árbol sobre un bloque
+     * sólido cuenta como decoración de la superficie, igual que al generar.
+     * No actualiza minHeight/maxHeight: llamar a updateHeightBounds() después.
+     */
+    void refreshColumn(int x, int z);
+
+    /**
+     * @brief Recalcula las alturas mínima y máxima del chunk desde el heightmap
+     *
+     * OPTIMIZACIÓN: Bounding volume ajustado para frustum culling.
+     * Debe llamarse después de rellenar el heightmap (generateTerrain).
+     * maxHeight es el techo de lo que se dibuja. minHeight es la columna más
+     * baja, no el bloque dibujado más bajo: el renderer baja el piso del
+     * volumen según el LOD (hasta y=0 con caras expuestas en bordes y cuevas).
+     */
+    void updateHeightBounds() {
+        auto [minIt, maxIt] = std::minmax_element(m_heightMap.begin(), m_heightMap.end());
+        m_minHeight = *minIt;
+        m_maxHeight = *maxIt;
+    }
+
+    /**
+     * @brief Obtiene la menor altura de superficie del chunk
+     * @return Mínimo del heightmap (puede haber caras expuestas por debajo: bordes, cuevas)
+     */
+    int getMinHeight() const { return m_minHeight; }
+
+    /**
+     * @brief Obtiene la mayor altura sólida del chunk (incluye árboles)
+     * @return Máximo del heightmap
+     */
+    int getMaxHeight() const { return m_maxHeight; }
+
+    /**
+     * @brief Obtiene el chunk vecino publicado en un lado
+     * @param side Lado del vecino
+     * @return Vecino o nullptr si no está cargado
+     *
+     * OPTIMIZACIÓN: Face culling en los bordes. Con el vecino cargado, las
+     * caras laterales del borde se comprueban contra sus bloques en lugar de
+     * darse siempre por expuestas. Los enlaces los mantiene el World en el
+     * thread principal (al publicar y al descargar chunks).
+     */
+    const Chunk* getNeighbor(ChunkSide side) const { return m_neighbors[static_cast<int>(side)]; }
+
+    /**
+     * @brief Enlaza (o desenlaza con nullptr) el vecino de un lado
+     * @param side Lado del vecino
+     * @param neighbor Chunk vecino
+     */
+    void setNeighbor(ChunkSide side, Chunk* neighbor) { m_neighbors[static_cast<int>(side)] = neighbor; }
+
     /**
      * @brief Limpia el chunk para reutilización (Object Pooling)
      *
@@ -469,6 +646,11 @@ public:
 
         // Limpiar heightmap
         m_heightMap.fill(0);
+        m_surface.fill(SurfaceColumn{});
+        m_minHeight = 0;
+        m_maxHeight = 0;
+        m_neighbors.fill(nullptr);
+        m_lastUsed = 0;
     }
 
     /**
@@ -518,5 +700,29 @@ private:
     // Acceso O(1) directo por índice (perfecta cache locality)
     DenseBlockStorage m_blocks;   ///< Storage denso de bloques (array + índices compactos)
     bool m_generated;             ///< Estado de generación: true si ya se generó el terreno
-    std::array<int, 64> m_heightMap{};  ///< Altura máxima sólida por columna (x*8 + z) para occlusion culling
+    std::array<int, 64> m_heightMap{};  ///< Altura máxima sólida por columna (x + z*8) para occlusion culling
+    std::array<SurfaceColumn, 64> m_surface{};  ///< Superficie cacheada por columna (x + z*8) para el LOD lejano
+    int m_minHeight = 0;          ///< Mínimo del heightmap (bounding volume para culling)
+    int m_maxHeight = 0;          ///< Máximo del heightmap (bounding volume para culling)
+    std::array<Chunk*, 4> m_neighbors{};  ///< Vecinos publicados por ChunkSide (solo thread principal)
+    uint32_t m_lastUsed = 0;      ///< Reloj de uso del World en el último acceso (LRU)
+};
+
+/**
+ * @struct ImpostorChunk
+ * @brief Chunk "impostor" de solo superficie para el horizonte lejano
+ *
+ * OPTIMIZACIÓN: Tier de horizonte barato.
+ * Más allá del radio de chunks completos, el mundo solo necesita la silueta
+ * del terreno. Un impostor guarda únicamente la superficie de cada columna
+ * (altura + bioma), generada con el ruido 2D del terreno - sin ruido 3D de
+ * cuevas, sin árboles y sin storage de bloques.
+ *
+ * Memoria: ~200 bytes por impostor frente a ~4KB + bloques densos de un Chunk.
+ */
+struct ImpostorChunk {
+    ChunkPos position;                          ///< Posición del chunk impostor
+    std::array<SurfaceColumn, 64> surface{};   ///< Superficie por columna (x + z*8)
+    int minHeight = 0;                          ///< Altura mínima de superficie (culling)
+    int maxHeight = 0;                          ///< Altura máxima de superficie (culling)
 };
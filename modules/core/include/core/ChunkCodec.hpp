@@ -0,0 +1,54 @@
+/**
+ * @file ChunkCodec.hpp
+ * @brief Compresión de chunks para el tier frío (paleta + RLE)
+ *
+ * Un chunk cargado ocupa ~7 KB: 4 KB fijos de índices más los arrays densos.
+ * Los chunks fuera de la vista que nadie lee se guardan comprimidos en el
+ * World y se expanden al volver a pedirse.
+ *
+ * Formato (bytes):
+ * - Versión (1)
+ * - Heightmap: 64 alturas de un byte (WORLD_HEIGHT = 32)
+ * - Superficie: 64 SurfaceColumn de 4 bytes
+ *   (ambos por columna en orden x + z * CHUNK_SIZE, como en Chunk)
+ * - Paleta: cantidad (1 byte, 1..255 + 0 = 256) y pares (tipo, variante)
+ * - Bloques en orden de índice (x, z, y): runs de (entrada de paleta,
+ *   largo en varint LEB128) hasta cubrir los 2048 bloques
+ *
+ * El orden de índice recorre capas horizontales de 8x8: el aire de arriba y
+ * la piedra de abajo son runs de cientos de bloques. Un chunk típico queda
+ * en unos cientos de bytes.
+ *
+ * No depende de SDL ni del World: se puede usar desde los jobs.
+ */
+
+#pragma once
+
+#include "core/Chunk.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ChunkCodec {
+
+/**
+ * @brief Comprime los bloques, heightmap y superficie de un chunk
+ * @param chunk Chunk generado
+ * @param out Buffer de salida (se limpia; conserva su capacidad)
+ * @return false si el chunk no cabe en el formato (más de 256 pares tipo/variante)
+ */
+bool compress(const Chunk& chunk, std::vector<uint8_t>& out);
+
+/**
+ * @brief Reconstruye un chunk comprimido
+ * @param data Bytes producidos por compress()
+ * @param size Cantidad de bytes
+ * @param chunk Chunk vacío (recién creado o limpio del pool) con su posición
+ * @return false si los datos están corruptos (el chunk queda a medio rellenar)
+ *
+ * Valida alturas, tipos y variantes además de la estructura: acepta datos
+ * leídos de un archivo. Deja el chunk marcado como generado.
+ */
+bool decompress(const uint8_t* data, size_t size, Chunk& chunk);
+
+} // namespace ChunkCodec
@@ -0,0 +1,89 @@
+/**
+ * @file ChunkPrefetcher.hpp
+ * @brief Prefetch predictivo de chunks según la velocidad de la cámara
+ *
+ * El anillo LOAD_MARGIN alrededor de la vista es simétrico: en vuelo recto
+ * la mitad que queda detrás se carga para nada y la de adelante se queda
+ * corta, así que los chunks del borde de avance aparecen con huecos.
+ *
+ * El prefetcher guarda las posiciones de la cámara de los últimos ticks,
+ * estima la velocidad y predice dónde estará dentro de LOOKAHEAD_SECONDS.
+ * La región visible en esa posición se pide con alta prioridad antes de que
+ * la cámara llegue; detrás del movimiento Game descarga antes.
+ *
+ * No depende de SDL.
+ */
+
+#pragma once
+
+#include "core/Camera.hpp"
+#include "core/Chunk.hpp"
+#include <array>
+#include <vector>
+
+/**
+ * @class ChunkPrefetcher
+ * @brief Estimador de velocidad y región visible prevista
+ *
+ * Uso: addSample() una vez por tick con la posición de la cámara y
+ * getPredictedChunks() cuando la cámara cambia de chunk.
+ */
+class ChunkPrefetcher {
+public:
+    static constexpr int HISTORY_SIZE = 16;            ///< Ticks usados para estimar la velocidad
+    static constexpr float LOOKAHEAD_SECONDS = 0.75f;  ///< Cuánto adelante se predice la posición
+    static constexpr int MAX_LOOKAHEAD_CHUNKS = 6;     ///< Límite del desplazamiento previsto (Chebyshev)
+    static constexpr float MIN_SPEED = 2.0f;           ///< Bloques por segundo para considerar movimiento
+
+    /**
+     * @brief Registra la posición de la cámara en este tick
+     * @param x, z Posición horizontal (coordenadas mundiales)
+     * @param deltaTime Duración del tick (segundos)
+     */
+    void addSample(float x, float z, float deltaTime);
+
+    /**
+     * @brief Olvida el historial (p.ej. tras un teletransporte)
+     */
+    void reset();
+
+    /** @brief Velocidad estimada en X (bloques/s) */
+    float getVelocityX() const { return m_velocityX; }
+
+    /** @brief Velocidad estimada en Z (bloques/s) */
+    float getVelocityZ() const { return m_velocityZ; }
+
+    /** @brief true si la velocidad supera MIN_SPEED */
+    bool isMoving() const;
+
+    /**
+     * @brief Desplazamiento previsto en chunks dentro de LOOKAHEAD_SECONDS
+     * @return Offset (0, 0) si la cámara está quieta
+     */
+    ChunkPos getLookaheadChunks() const;
+
+    /**
+     * @brief Región visible en la posición prevista
+     * @param camera Cámara actual (se copia y se desplaza)
+     * @param screenWidth, screenHeight Tamaño de la ventana (píxeles)
+     * @param marginChunks Chunks de margen alrededor de la vista
+     * @param maxRadius Límite del diamante (Chebyshev, en chunks)
+     * @param out Posiciones ordenadas de la más cercana a la cámara actual a
+     *            la más lejana (vacío si la cámara está quieta)
+     */
+    void getPredictedChunks(const Camera& camera, int screenWidth, int screenHeight,
+                            int marginChunks, int maxRadius, std::vector<ChunkPos>& out) const;
+
+private:
+    struct Sample {
+        float x, z;   ///< Posición de la cámara
+        float time;   ///< Tiempo acumulado al tomar la muestra (segundos)
+    };
+
+    std::array<Sample, HISTORY_SIZE> m_samples{};  ///< Buffer circular de muestras
+    int m_next = 0;        ///< Próxima posición a escribir
+    int m_count = 0;       ///< Muestras válidas
+    float m_time = 0.0f;   ///< Tiempo acumulado
+    float m_velocityX = 0.0f;
+    float m_velocityZ = 0.0f;
+};
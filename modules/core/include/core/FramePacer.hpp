@@ -0,0 +1,90 @@
+/**
+ * @file FramePacer.hpp
+ * @brief Limitador de frames adaptativo (sleep + spin contra un deadline)
+ *
+ * Sin límite el game loop renderiza frames que nadie ve y mantiene un núcleo
+ * al 100%, lo que en equipos con poca refrigeración termina en thermal
+ * throttling de los frames que sí importan.
+ *
+ * El pacer mantiene un deadline por frame (periodo = 1/objetivo). Al final
+ * de cada frame duerme hasta poco antes del deadline y completa la espera
+ * con spin. El margen de spin se ajusta con el exceso medido de los sleeps
+ * del sistema operativo, así se duerme todo lo posible sin pasarse.
+ *
+ * Si el trabajo del frame supera el deadline se cuenta como deadline perdido
+ * y el siguiente deadline se calcula desde ahora (no se intenta recuperar
+ * el atraso encadenando frames sin espera).
+ *
+ * No depende de SDL.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class FramePacer
+ * @brief Espera entre frames para mantener una frecuencia objetivo
+ *
+ * Uso: una llamada a waitForNextFrame() al final de cada frame (tras present).
+ */
+class FramePacer {
+public:
+    /**
+     * @brief Constructor
+     * @param targetFps Frecuencia objetivo (0 = sin límite)
+     *
+     * En Windows sube la resolución del timer del sistema a 1 ms mientras
+     * el pacer exista (Sleep tiene granularidad de ~15.6 ms por defecto).
+     */
+    explicit FramePacer(int targetFps = 60);
+
+    ~FramePacer();
+
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    /**
+     * @brief Cambia la frecuencia objetivo
+     * @param targetFps Frames por segundo (0 = sin límite, modo benchmark)
+     */
+    void setTargetFps(int targetFps);
+
+    /** @brief Frecuencia objetivo (0 = sin límite) */
+    int getTargetFps() const { return m_targetFps; }
+
+    /**
+     * @brief Espera hasta el deadline del frame actual
+     *
+     * Sin límite solo mide el costo del frame y vuelve de inmediato.
+     */
+    void waitForNextFrame();
+
+    /** @brief Frames cuyo trabajo superó el deadline */
+    uint64_t getMissedDeadlines() const { return m_missedDeadlines; }
+
+    /** @brief Frames pasados por el pacer */
+    uint64_t getFrameCount() const { return m_frameCount; }
+
+    /** @brief Costo del último frame sin contar la espera (ms) */
+    float getLastWorkMs() const { return m_lastWorkMs; }
+
+    /** @brief Margen de spin actual (ms) */
+    float getSpinMarginMs() const { return static_cast<float>(m_spinMarginUs / 1000.0); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double MIN_SPIN_MARGIN_US = 200.0;   ///< Margen mínimo de spin
+    static constexpr double MAX_SPIN_MARGIN_US = 4000.0;  ///< Margen máximo (sleeps muy imprecisos)
+
+    int m_targetFps = 0;
+    Clock::duration m_period{0};        ///< Duración objetivo del frame
+    Clock::time_point m_frameStart;     ///< Inicio del frame actual (fin de la última espera)
+    Clock::time_point m_deadline;       ///< Deadline del frame actual
+    double m_spinMarginUs = 1000.0;     ///< Tiempo reservado para spin antes del deadline
+    uint64_t m_missedDeadlines = 0;
+    uint64_t m_frameCount = 0;
+    float m_lastWorkMs = 0.0f;
+};
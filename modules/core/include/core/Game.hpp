@@ -12,9 +12,15 @@
 #include "core/Camera.hpp"
 #include "rendering/Renderer.hpp"
 #include "core/Player.hpp"
+#include "core/Benchmark.hpp"
+#include "core/InputLog.hpp"
+#include "core/FramePacer.hpp"
+#include "core/ChunkPrefetcher.hpp"
 #include <SDL2/SDL.h>
 #include <memory>
+#include <chrono>
 #include <atomic>
+#include <string>
 
 /**
  * @struct GameState
@@ -36,6 +42,40 @@ struct GameState {
     // Control de zoom (+/-)
     bool zoomIn = false;    ///< +: acercar (aumentar zoom)
     bool zoomOut = false;   ///< -: alejar (disminuir zoom)
+
+    bool jumpRequested = false;  ///< ESPACIO: salto pendiente (se aplica en el próximo tick)
+};
+
+/**
+ * @struct SimRenderState
+ * @brief Estado de la simulación que el render interpola entre ticks
+ */
+struct SimRenderState {
+    float playerX = 0.0f, playerY = 0.0f, playerZ = 0.0f;  ///< Posición visual del jugador (= cámara)
+    float zoom = 1.0f;                                      ///< Zoom de la cámara
+};
+
+/**
+ * @struct GameConfig
+ * @brief Opciones de arranque (línea de comandos, ver src/main.cpp)
+ */
+struct GameConfig {
+    uint32_t seed = 0;              ///< Semilla del mundo (solo si hasSeed; 0 es una semilla válida)
+    bool hasSeed = false;           ///< false = semilla aleatoria con std::time
+    bool benchmark = false;         ///< Modo benchmark: recorrido scriptado + deltaTime fijo
+    int benchmarkFrames = 2880;     ///< Frames a medir en modo benchmark (una vuelta del recorrido)
+    bool headless = false;          ///< Ventana oculta (se sigue renderizando)
+    std::string benchmarkOutput = "benchmark.json";  ///< Archivo JSON de resultados
+    std::string recordInputPath;    ///< Grabar el input en este log (vacío = no grabar)
+    std::string replayInputPath;    ///< Reproducir este log en lugar del teclado (vacío = no)
+    int tickRate = 60;              ///< Frecuencia de la simulación (ticks por segundo)
+    int targetFps = 60;             ///< Límite de FPS del render (0 = sin límite)
+    bool checkAllocs = false;       ///< Verificar que los frames estables no reservan heap (cámara quieta)
+    bool prefetch = true;           ///< Prefetch predictivo de chunks según la velocidad (--no-prefetch lo desactiva)
+    int chunkBudgetMB = 64;         ///< Presupuesto de memoria de los chunks cargados (MB, --chunk-budget-mb)
+    std::string loadPath;           ///< Guardado a cargar al iniciar (vacío = mundo nuevo; fija la semilla)
+    std::string savePath = "world.sav";  ///< Archivo donde F5 guarda las ediciones (--save, o el de --load)
+    std::string snapshotPath;       ///< Snapshot a reanudar al iniciar y a escribir al salir (vacío = no)
 };
 
 /**
@@ -46,22 +86,25 @@ struct GameState {
  *
  * Arquitectura:
  * - init(): Inicializa SDL2, ventana, renderer, mundo, cámara, jugador
- * - run(): Game loop principal (handleInput -> update -> render)
+ * - run(): Game loop principal (handleInput -> update a paso fijo -> render interpolado)
  * - handleInput(): Procesa eventos SDL (teclado, ventana)
  * - update(): Actualiza lógica (movimiento, chunks)
  * - render(): Renderiza mundo y jugador
  * - cleanup(): Libera recursos
  *
  * Sistema de chunks:
- * - RENDER_RADIUS: chunks visibles para renderizado
- * - LOAD_RADIUS: chunks cargados en memoria
- * - UNLOAD_DISTANCE: distancia para liberar chunks
+ * - Conjunto visible: diamante derivado del frustum (limitado por MAX_RENDER_RADIUS)
+ * - HORIZON_RADIUS: más allá, impostores de solo superficie (sin generación 3D)
+ * - LOAD_MARGIN: anillo de prefetch alrededor del conjunto visible
+ * - ChunkPrefetcher: región visible prevista según la velocidad (alta prioridad)
+ * - Presupuesto de memoria (--chunk-budget-mb): los chunks se descargan por LRU solo al superarlo
  * - MOVEMENT_THRESHOLD: movimiento mínimo para recargar chunks
  *
  * Controles:
  * - WASD: movimiento horizontal (cardinal: N/S/E/W)
  * - +/-: zoom in/out
  * - P: pausar
+ * - F5: guardar las ediciones del mundo (solo los bloques cambiados)
  * - ESC: salir
  */
 class Game {
@@ -89,24 +132,26 @@ public:
      * 2. Crear ventana (1280x720, redimensionable)
      * 3. Crear renderer
      * 4. Crear mundo con semilla aleatoria
-     * 5. Crear cámara
-     * 6. Generar chunks iniciales
+     * 5. Crear cámara (sobre la columna de spawn)
+     * 6. Fase de carga: generar la región inicial en paralelo (pregenerateStartArea)
      * 7. Crear jugador
-     * 8. Spawnsar jugador en superficie
+     * 8. Spawnsar jugador en superficie (heightmap del chunk ya publicado)
      * 9. Posicionar cámara en jugador
+     *
+     * @param config Opciones de arranque (semilla fija, benchmark, headless)
      */
-    bool init();
+    bool init(const GameConfig& config = GameConfig());
 
     /**
      * @brief Ejecuta el game loop principal
      *
      * Loop principal:
      * while (running):
-     *   - Calcular deltaTime
+     *   - Calcular deltaTime del frame
      *   - handleInput(): procesar eventos
-     *   - if (!paused): update(deltaTime)
-     *   - render()
-     *   - Limitar FPS a 60
+     *   - if (!paused): simulate(deltaTime) (0..N ticks de paso fijo)
+     *   - render() con el estado interpolado entre los dos últimos ticks
+     *   - m_framePacer.waitForNextFrame(): esperar al deadline del frame
      */
     void run();
 
@@ -118,6 +163,11 @@ public:
      */
     void cleanup();
 
+    /**
+     * @brief true si --check-allocs encontró frames estables con reservas de heap
+     */
+    bool allocationCheckFailed() const { return m_allocFailedFrames > 0; }
+
 private:
     /**
      * @brief Procesa input del usuario
@@ -137,27 +187,77 @@ private:
     void handleInput();
 
     /**
-     * @brief Actualiza la lógica del juego
-     * @param deltaTime Tiempo transcurrido desde el último frame (segundos)
+     * @brief Aplica un evento al estado del juego (teclado real o reproducido)
+     * @param event Evento SDL
+     */
+    void handleEvent(const SDL_Event& event);
+
+    /**
+     * @brief Agrega un evento al log de input si hay grabación en curso
+     * @param event Evento SDL (solo se graban teclado, resize y quit)
+     */
+    void recordInputEvent(const SDL_Event& event);
+
+    /**
+     * @brief Registra las reservas de heap de un frame (--check-allocs)
+     * @param frame Índice de frame desde el inicio de run()
+     * @param allocations Reservas del thread principal durante el frame
+     *
+     * Solo cuenta frames estables: pasado el calentamiento y sin chunks
+     * pendientes de generar (la cámara está quieta en este modo).
+     */
+    void recordFrameAllocations(int frame, uint64_t allocations);
+
+    /**
+     * @brief Avanza la simulación con paso fijo
+     * @param frameDelta Tiempo real del frame (segundos)
+     * @return Fracción [0, 1) del siguiente tick ya transcurrida (alpha de interpolación)
+     *
+     * Acumula el tiempo del frame y ejecuta update() con deltaTime = 1/tickRate
+     * tantas veces como corresponda. La simulación no depende de los FPS: a 40 o
+     * a 400 FPS los timers de gravedad y los cooldowns avanzan igual.
+     * Como mucho MAX_TICKS_PER_FRAME por frame: tras un pico de render el
+     * tiempo sobrante se descarta en lugar de encadenar frames cada vez más lentos.
+     */
+    float simulate(float frameDelta);
+
+    /**
+     * @brief Ejecuta un tick de la simulación
+     * @param deltaTime Paso fijo de la simulación (segundos)
      *
      * Llama a:
      * - updateCamera(): movimiento del jugador y cámara
      * - updateChunks(): carga/descarga de chunks
+     *
+     * No depende del render: puede ejecutarse más rápido que el tiempo real.
      */
     void update(float deltaTime);
 
+    /**
+     * @brief Captura el estado de la simulación tras un tick
+     */
+    SimRenderState captureRenderState() const;
+
+    /**
+     * @brief Aplica a la cámara el estado interpolado entre los dos últimos ticks
+     * @param alpha Fracción del tick siguiente ya transcurrida [0, 1]
+     * @param playerX, playerY, playerZ Posición interpolada del jugador (salida)
+     */
+    void applyRenderState(float alpha, float& playerX, float& playerY, float& playerZ);
+
     /**
      * @brief Renderiza el juego
+     * @param alpha Fracción del tick siguiente ya transcurrida (interpolación)
      *
      * Pipeline:
      * 1. renderer->clear(): limpiar pantalla
-     * 2. Obtener chunks visibles (RENDER_RADIUS)
+     * 2. Obtener chunks visibles (diamante del frustum)
      * 3. renderer->renderWorld(): renderizar terreno
      * 4. renderer->renderPlayer(): renderizar jugador
      * 5. renderer->present(): mostrar en pantalla
      * 6. Mostrar FPS (cada 1 segundo)
      */
-    void render();
+    void render(float alpha);
 
     /**
      * @brief Actualiza la posición del jugador y cámara
@@ -186,9 +286,9 @@ private:
      * Proceso:
      * 1. Obtener posición actual de la cámara en coordenadas de chunk
      * 2. Calcular distancia desde la última posición
-     * 3. Si distancia >= MOVEMENT_THRESHOLD:
-     *    a. Descargar chunks lejanos (unloadChunksFarFrom)
-     *    b. Cargar nuevos chunks necesarios (getChunksAround)
+     * 3. Si distancia >= MOVEMENT_THRESHOLD o cambió el zoom/ventana:
+     *    a. Si se superó el presupuesto de memoria, descargar por LRU (evictChunks)
+     *    b. Cargar el diamante visible + LOAD_MARGIN (getChunks)
      *    c. Actualizar última posición
      *    d. Mostrar estadísticas (cada 1 segundo)
      *
@@ -196,6 +296,29 @@ private:
      */
     void updateChunks();
 
+    /**
+     * @brief Fase de carga: genera la región de carga inicial antes del primer frame
+     *
+     * OPTIMIZACIÓN: Los chunks se generan en paralelo en todos los núcleos
+     * (World::pregenerateChunks) mientras se dibuja una barra de progreso.
+     * Al reanudar un snapshot, la misma fase expande los chunks fríos.
+     * El primer frame ya tiene la vista completa y el jugador aparece sobre
+     * un chunk publicado.
+     */
+    void pregenerateStartArea();
+
+    /**
+     * @brief Sustituye el input del teclado por el del recorrido scriptado
+     * @param frame Índice de frame del benchmark
+     */
+    void applyBenchmarkInput(int frame);
+
+    /**
+     * @brief Escribe los resultados del benchmark (archivo JSON y stdout)
+     * @param wallTimeSeconds Duración total de los frames medidos
+     */
+    void writeBenchmarkResults(double wallTimeSeconds);
+
     /**
      * @brief Obtiene ChunkPos desde coordenadas de cámara con cache
      * @param camX, camY, camZ Coordenadas de la cámara
@@ -231,31 +354,88 @@ private:
     std::unique_ptr<World> m_world;          ///< Mundo procedural infinito
     std::unique_ptr<Camera> m_camera;        ///< Cámara isométrica
     std::unique_ptr<Player> m_player;        ///< Jugador
+    SpriteHandle m_playerSprite = INVALID_SPRITE;  ///< Handle de la textura del jugador (resuelto en init)
 
     GameState m_state;                       ///< Estado del juego
+    GameConfig m_config;                     ///< Opciones de arranque
+    std::vector<float> m_benchmarkFrameTimes;  ///< Tiempo de cada frame medido (ms, modo benchmark)
+    uint32_t m_benchmarkStartChunks = 0;     ///< Chunks generados antes del primer frame medido
+    double m_benchmarkStartGenerationMs = 0.0;  ///< Tiempo de generación antes del primer frame medido
+    uint32_t m_benchmarkMissingFrames = 0;   ///< Frames medidos con chunks de la región visible sin generar
+    uint32_t m_benchmarkStartEvicted = 0;    ///< Chunks descargados por presupuesto antes del primer frame medido
+    uint32_t m_benchmarkStartThawed = 0;     ///< Chunks expandidos del tier frío antes del primer frame medido
+
+    // Arranque: fase de carga y tiempo hasta el primer frame jugable
+    static constexpr Uint64 LOADING_REDRAW_MS = 16;  ///< Intervalo mínimo entre redibujos de la pantalla de carga
+    std::chrono::steady_clock::time_point m_initStart;  ///< Inicio de init() (referencia del primer frame)
+    int m_startupChunks = 0;                 ///< Chunks de la región de carga inicial
+    double m_startupLoadMs = 0.0;            ///< Duración de la fase de carga (ms)
+    double m_timeToFirstFrameMs = 0.0;       ///< init() hasta el primer frame con la vista completa (0 = aún no)
+
+    // Verificación de reservas por frame (--check-allocs)
+    static constexpr int ALLOC_CHECK_WARMUP_FRAMES = 120;  ///< Frames ignorados mientras se carga la vista
+    int m_allocCheckedFrames = 0;            ///< Frames estables verificados
+    int m_allocFailedFrames = 0;             ///< Frames estables que reservaron heap en el thread principal
+    uint64_t m_allocMaxPerFrame = 0;         ///< Máximo de reservas en un frame estable
+
+    // Grabación / reproducción de input (ver InputLog.hpp)
+    InputRecorder m_inputRecorder;                   ///< Grabación en curso (si --record)
+    std::unique_ptr<InputReplayer> m_inputReplayer;  ///< Log reproducido (nullptr = teclado real)
+    std::vector<InputEvent> m_replayEvents;          ///< Eventos grabados del frame actual
 
     Uint64 m_lastFrameTime;                  ///< Tiempo del último frame (ms)
-    const int FPS = 60;                      ///< Objetivo de FPS
-    const int FRAME_DELAY = 1000 / FPS;       ///< Delay por frame (ms) para 60 FPS
+    FramePacer m_framePacer;                 ///< Limitador de FPS (sleep + spin hasta el deadline)
+
+    // Simulación a paso fijo con render interpolado
+    static constexpr int MAX_TICKS_PER_FRAME = 8;  ///< Límite de ticks por frame (evita la espiral de la muerte)
+    float m_tickDelta = 1.0f / 60.0f;        ///< Paso fijo de la simulación (segundos)
+    double m_tickAccumulator = 0.0;          ///< Tiempo real pendiente de simular (segundos)
+    int m_lastTickCount = 0;                 ///< Ticks ejecutados en el último frame
+    SimRenderState m_prevRenderState;        ///< Estado tras el penúltimo tick
+    SimRenderState m_currRenderState;        ///< Estado tras el último tick
 
     // Contador de FPS
     Uint64 m_fpsUpdateTime = 0;           ///< Última vez que se actualizaron los FPS (ms)
     int m_frameCount = 0;                  ///< Contador de frames desde la última actualización
     int m_currentFPS = 0;                  ///< FPS actual (calculado cada segundo)
+    float m_averageFrameMs = 0.0f;         ///< Tiempo medio por frame en el último segundo (ms)
+    bool m_showProfiler = false;           ///< Mostrar el gráfico del profiler (F3, requiere ENABLE_PROFILER)
+    int m_traceDumpCount = 0;              ///< Trazas volcadas con F4 (requiere ENABLE_TRACING)
 
     // Configuración de carga de chunks optimizada
-    static constexpr int RENDER_RADIUS = 5;       ///< Radio de chunks a renderizar (11x11 = 121)
-    static constexpr int LOAD_RADIUS = 6;         ///< Radio de chunks en memoria (13x13 = 169)
-    static constexpr int UNLOAD_DISTANCE = 9;     ///< Distancia para descartar chunks lejanos
+    // OPTIMIZACIÓN: El conjunto visible se deriva del frustum (Camera::getVisibleChunks),
+    // un diamante isométrico que depende del zoom y del tamaño de ventana.
+    static constexpr int MAX_RENDER_RADIUS = 20;  ///< Límite del diamante visible (Chebyshev, en chunks); el LOD por superficie lo hace asumible
+    static constexpr int HORIZON_RADIUS = 48;     ///< Radio del horizonte de impostores (solo superficie)
+    static constexpr int LOAD_MARGIN = 1;         ///< Anillo extra de prefetch alrededor de la vista
+    static constexpr int UNLOAD_MARGIN = 3;       ///< Chunks extra más allá de la vista protegidos de la descarga
+    static constexpr double CHUNK_PUBLISH_BUDGET_MS = 1.0;  ///< Tiempo por frame para publicar chunks generados
+    static constexpr double COLD_COMPRESS_BUDGET_MS = 1.0;  ///< Tiempo por actualización de carga para comprimir chunks
     static constexpr int MOVEMENT_THRESHOLD = 2;  ///< Movimiento mínimo para recargar chunks
+    static constexpr int PREFETCH_UNLOAD_MARGIN = 1;  ///< Margen protegido detrás del movimiento (en lugar de UNLOAD_MARGIN)
     static constexpr float ZOOM_SPEED = 2.0f;     ///< Segundos para zoom min->max
 
     // Seguimiento de movimiento para optimizar carga/descarga
     ChunkPos m_lastChunkPos;         ///< Última posición de la cámara (en coordenadas de chunk)
+    ChunkPos m_lastPrefetchChunkPos; ///< Chunk de la cámara en el último prefetch
+    ChunkPrefetcher m_prefetcher;    ///< Velocidad de la cámara y región prevista
     Uint64 m_lastChunkUpdateTime;   ///< Última vez que se mostraron estadísticas de chunks
 
     // OPTIMIZACIÓN FASE 3: Object pool para evitar allocations en render()
-    std::vector<Chunk*> m_visibleChunksCache;  ///< Cache reutilizable de chunks visibles
+    std::vector<ChunkPos> m_visibleChunkPositions;  ///< Diamante visible + 1 chunk de margen (región visible del World)
+    std::vector<ChunkPos> m_loadChunkPositions;     ///< Diamante de carga = vista + LOAD_MARGIN (reutilizable)
+    std::vector<ChunkPos> m_prefetchChunkPositions; ///< Diamante de carga en la posición prevista (reutilizable)
+    std::vector<ChunkPos> m_impostorPositions;      ///< Parte del diamante visible más allá de MAX_RENDER_RADIUS
+    std::vector<const ImpostorChunk*> m_visibleImpostorsCache;  ///< Impostores de horizonte visibles (reutilizable)
+
+    // Tamaño del viewport para derivar el conjunto visible
+    int m_viewportWidth = 1280;      ///< Ancho de la ventana (píxeles)
+    int m_viewportHeight = 720;      ///< Alto de la ventana (píxeles)
+    float m_lastLoadZoom = -1.0f;    ///< Zoom usado en la última carga (recargar si cambia la forma)
+    bool m_viewportDirty = true;     ///< true si la ventana cambió desde la última carga
+    ChunkPos m_visibleRegionCenter;  ///< Chunk de la cámara al calcular la región visible
+    float m_visibleRegionZoom = -1.0f;  ///< Zoom al calcular la región visible
+    bool m_visibleRegionDirty = true;   ///< true si la ventana cambió desde el último cálculo de la región
 
     // OPTIMIZACIÓN FASE 4: Cache de ChunkPos para evitar conversiones repetidas
     float m_cachedCamX = 0.0f, m_cachedCamY = 0.0f, m_cachedCamZ = 0.0f;
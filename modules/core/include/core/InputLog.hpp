@@ -0,0 +1,152 @@
+/**
+ * @file InputLog.hpp
+ * @brief Grabación y reproducción del input en un log binario compacto
+ *
+ * Permite reproducir exactamente una sesión (p.ej. una sesión con stutter
+ * reportada por un jugador) bajo el profiler: el log guarda la semilla, el
+ * tamaño de ventana, la frecuencia de ticks, el deltaTime de cada frame y los
+ * eventos de input recibidos en ese frame. Al reproducir, los eventos se entregan en el mismo
+ * frame en que ocurrieron y la simulación avanza con los mismos deltaTime.
+ *
+ * Formato (little-endian):
+ * - Cabecera: "IGIL", versión (u16), semilla (u32), ancho (i32), alto (i32),
+ *   ticks por segundo (u16, desde la versión 2)
+ * - Por frame: deltaTime (f32), cantidad de eventos (u16), eventos
+ * - Por evento: tipo (u8) + datos (KEY_*: keycode i32, RESIZE: w, h i32, QUIT: nada)
+ *
+ * No depende de SDL: el Game traduce entre SDL_Event e InputEvent.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @enum InputEventType
+ * @brief Tipos de evento grabados
+ */
+enum class InputEventType : uint8_t {
+    KEY_DOWN = 1,  ///< Tecla presionada (incluye repeticiones)
+    KEY_UP = 2,    ///< Tecla liberada
+    RESIZE = 3,    ///< Ventana redimensionada
+    QUIT = 4       ///< Cierre de la ventana
+};
+
+/**
+ * @struct InputEvent
+ * @brief Evento de input independiente de SDL
+ */
+struct InputEvent {
+    InputEventType type = InputEventType::QUIT;
+    int32_t a = 0;  ///< Keycode (KEY_*) o ancho (RESIZE)
+    int32_t b = 0;  ///< Alto (RESIZE)
+};
+
+/**
+ * @class InputRecorder
+ * @brief Escribe el log de input frame a frame
+ *
+ * Uso por frame: beginFrame(deltaTime) -> record(evento)* -> endFrame()
+ */
+class InputRecorder {
+public:
+    static constexpr size_t MAX_FRAME_EVENTS = UINT16_MAX;  ///< Límite del contador de eventos (u16)
+
+    /**
+     * @brief Crea el archivo y escribe la cabecera
+     * @param path Ruta del log
+     * @param seed Semilla del mundo
+     * @param width, height Tamaño de ventana inicial
+     * @param tickRate Frecuencia de la simulación (ticks por segundo)
+     * @return true si el archivo se abrió
+     */
+    bool open(const std::string& path, uint32_t seed, int width, int height, int tickRate);
+
+    /** @brief true si hay una grabación en curso */
+    bool isOpen() const { return m_file.is_open(); }
+
+    /**
+     * @brief Inicia un frame
+     * @param deltaTime deltaTime con el que se simulará el frame
+     */
+    void beginFrame(float deltaTime);
+
+    /**
+     * @brief Agrega un evento al frame actual
+     */
+    void record(const InputEvent& event);
+
+    /**
+     * @brief Escribe el frame actual en el archivo
+     * @return false si el frame tiene más de MAX_FRAME_EVENTS eventos
+     *
+     * Un frame que no cabe en el formato no se trunca: la grabación se
+     * cierra y el log conserva los frames anteriores, que se reproducen bien.
+     */
+    bool endFrame();
+
+    /**
+     * @brief Cierra el archivo (escribe el frame pendiente)
+     */
+    void close();
+
+    /** @brief Frames grabados */
+    uint32_t getFrameCount() const { return m_frameCount; }
+
+private:
+    std::ofstream m_file;
+    float m_frameDelta = 0.0f;
+    bool m_frameOpen = false;
+    uint32_t m_frameCount = 0;
+    std::vector<InputEvent> m_frameEvents;  ///< Eventos del frame actual
+    std::vector<uint8_t> m_bytes;           ///< Buffer de serialización (reutilizable)
+};
+
+/**
+ * @class InputReplayer
+ * @brief Lee un log de input frame a frame
+ */
+class InputReplayer {
+public:
+    /**
+     * @brief Abre el log y lee la cabecera
+     * @param path Ruta del log
+     * @return true si el archivo existe y tiene una cabecera válida
+     */
+    bool open(const std::string& path);
+
+    /** @brief Semilla con la que se grabó la sesión */
+    uint32_t getSeed() const { return m_seed; }
+
+    /** @brief Ancho de ventana al inicio de la grabación */
+    int getWidth() const { return m_width; }
+
+    /** @brief Alto de ventana al inicio de la grabación */
+    int getHeight() const { return m_height; }
+
+    /** @brief Ticks por segundo de la sesión grabada (0 = log de versión 1, sin el dato) */
+    int getTickRate() const { return m_tickRate; }
+
+    /**
+     * @brief Lee el siguiente frame
+     * @param deltaTime deltaTime grabado del frame
+     * @param events Eventos del frame (se reemplaza el contenido)
+     * @return false si el log terminó (o está truncado)
+     */
+    bool nextFrame(float& deltaTime, std::vector<InputEvent>& events);
+
+    /** @brief Frames leídos hasta ahora */
+    uint32_t getFrameCount() const { return m_frameCount; }
+
+private:
+    std::ifstream m_file;
+    uint32_t m_seed = 0;
+    int m_width = 0;
+    int m_height = 0;
+    int m_tickRate = 0;
+    uint32_t m_frameCount = 0;
+};
@@ -88,8 +88,8 @@ public:
      *
      * Algoritmo:
      * 1. Obtiene el chunk en la posición actual del jugador
-     * 2. Si el chunk no existe, lo genera
-     * 3. Busca desde arriba (Y=255) hacia abajo el primer bloque sólido
+     * 2. Si el chunk no existe, lo genera (la fase de carga ya lo dejó publicado)
+     * 3. Lee la altura del heightmap del chunk (sin recorrer la columna)
      * 4. Posiciona al jugador una unidad sobre ese bloque
      *
      * Esto asegura que el jugador siempre aparezca sobre el terreno
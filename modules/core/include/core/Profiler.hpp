@@ -0,0 +1,205 @@
+/**
+ * @file Profiler.hpp
+ * @brief Profiler por etapas del frame con historial en ring buffer
+ *
+ * Timers con scope y contadores ligeros para las etapas del game loop
+ * (input, jugador, carga de chunks, construcción de lista, sort, dibujo).
+ * Los resultados de los últimos frames se guardan en un ring buffer y el
+ * Renderer los muestra como gráfico apilado de tiempos (tecla F3).
+ *
+ * Compilación:
+ * - Con ENABLE_PROFILER definido los macros PROFILE_* miden y registran
+ * - Sin ENABLE_PROFILER los macros se expanden a nada (coste cero)
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @enum ProfileStage
+ * @brief Etapas medidas del frame
+ */
+enum class ProfileStage : uint8_t {
+    INPUT = 0,        ///< Game::handleInput
+    PLAYER_UPDATE,    ///< Player::update (física)
+    UPDATE_CHUNKS,    ///< Game::updateChunks (carga/descarga)
+    GET_CHUNKS,       ///< Obtener chunks e impostores visibles
+    BUILD_LIST,       ///< Construcción de la lista de tiles
+    SORT,             ///< Depth sort de tiles y sprites
+    SUBMIT,           ///< Envío de tiles/sprites a SDL
+    PRESENT,          ///< SDL_RenderPresent
+    COUNT
+};
+
+/**
+ * @enum ProfileCounter
+ * @brief Contadores por frame
+ */
+enum class ProfileCounter : uint8_t {
+    SOLID_BLOCKS = 0, ///< Bloques sólidos recorridos
+    CULLED_BLOCKS,    ///< Bloques descartados (ocultos o fuera de pantalla)
+    ADDED_BLOCKS,     ///< Tiles agregados a la lista
+    CHUNKS_DRAWN,     ///< Chunks que pasaron el culling
+    COUNT
+};
+
+constexpr size_t PROFILE_STAGE_COUNT = static_cast<size_t>(ProfileStage::COUNT);
+constexpr size_t PROFILE_COUNTER_COUNT = static_cast<size_t>(ProfileCounter::COUNT);
+
+/**
+ * @struct ProfileFrame
+ * @brief Mediciones de un frame completo
+ */
+struct ProfileFrame {
+    std::array<float, PROFILE_STAGE_COUNT> stageMs{};       ///< Tiempo por etapa (ms)
+    std::array<int32_t, PROFILE_COUNTER_COUNT> counters{};  ///< Contadores del frame
+    float totalMs = 0.0f;                                   ///< Duración total del frame (ms)
+};
+
+/**
+ * @class Profiler
+ * @brief Registro global de tiempos por etapa
+ *
+ * Instancia única (solo se usa desde el hilo principal). beginFrame() cierra
+ * el frame en curso, lo guarda en el historial y empieza uno nuevo.
+ */
+class Profiler {
+public:
+    static constexpr size_t HISTORY_SIZE = 240;  ///< Frames guardados (~4 s a 60 FPS)
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Obtiene la instancia global
+     */
+    static Profiler& instance();
+
+    /**
+     * @brief Cierra el frame actual (si hay uno) y empieza el siguiente
+     */
+    void beginFrame();
+
+    /**
+     * @brief Acumula tiempo en una etapa del frame actual
+     * @param stage Etapa
+     * @param ms Tiempo en milisegundos
+     */
+    void addStageTime(ProfileStage stage, float ms) {
+        m_current.stageMs[static_cast<size_t>(stage)] += ms;
+    }
+
+    /**
+     * @brief Fija el valor de un contador del frame actual
+     * @param counter Contador
+     * @param value Valor
+     */
+    void setCounter(ProfileCounter counter, int32_t value) {
+        m_current.counters[static_cast<size_t>(counter)] = value;
+    }
+
+    /**
+     * @brief Cantidad de frames completos en el historial
+     */
+    size_t getFrameCount() const { return m_count; }
+
+    /**
+     * @brief Obtiene un frame del historial
+     * @param age 0 = último frame completo, 1 = el anterior, ...
+     * @return Frame (age debe ser < getFrameCount())
+     */
+    const ProfileFrame& getFrame(size_t age) const {
+        return m_history[(m_head + HISTORY_SIZE - 1 - age) % HISTORY_SIZE];
+    }
+
+    /**
+     * @brief Percentiles de duración de frame sobre el historial
+     * @param p50, p95, p99 Resultados en ms (0 si no hay historial)
+     */
+    void getFrameTimePercentiles(float& p50, float& p95, float& p99) const;
+
+    /**
+     * @brief Tiempo medio de una etapa sobre el historial
+     * @param stage Etapa
+     * @return Media en ms
+     */
+    float getStageAverage(ProfileStage stage) const;
+
+    /**
+     * @brief Nombre corto de una etapa (para el gráfico)
+     */
+    static const char* getStageName(ProfileStage stage);
+
+    /**
+     * @brief Nombre corto de un contador (para el gráfico)
+     */
+    static const char* getCounterName(ProfileCounter counter);
+
+private:
+    Profiler() = default;
+
+    std::array<ProfileFrame, HISTORY_SIZE> m_history{};  ///< Ring buffer de frames
+    size_t m_head = 0;                   ///< Siguiente posición a escribir
+    size_t m_count = 0;                  ///< Frames válidos en el historial
+    ProfileFrame m_current;              ///< Frame en curso
+    Clock::time_point m_frameStart;      ///< Inicio del frame en curso
+    bool m_frameOpen = false;            ///< true si hay un frame en curso
+};
+
+/**
+ * @class ProfileScope
+ * @brief Timer RAII: suma el tiempo del scope a una etapa
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileStage stage)
+        : m_stage(stage), m_start(Profiler::Clock::now()) {}
+
+    ~ProfileScope() { stop(); }
+
+    /**
+     * @brief Termina la medición antes del fin del scope (idempotente)
+     */
+    void stop() {
+        if (m_stopped) {
+            return;
+        }
+        m_stopped = true;
+        const auto elapsed = Profiler::Clock::now() - m_start;
+        Profiler::instance().addStageTime(
+            m_stage, std::chrono::duration<float, std::milli>(elapsed).count());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileStage m_stage;
+    Profiler::Clock::time_point m_start;
+    bool m_stopped = false;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef ENABLE_PROFILER
+    /// Mide el resto del scope actual en la etapa indicada (p.ej. PROFILE_SCOPE(SORT))
+    #define PROFILE_SCOPE(stage) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(ProfileStage::stage)
+    /// Inicia una medición que termina en PROFILE_END(stage) (secciones sin scope propio)
+    #define PROFILE_BEGIN(stage) ProfileScope PROFILE_CONCAT(profileStage_, stage)(ProfileStage::stage)
+    /// Termina la medición iniciada con PROFILE_BEGIN(stage)
+    #define PROFILE_END(stage) PROFILE_CONCAT(profileStage_, stage).stop()
+    /// Registra un contador del frame (p.ej. PROFILE_COUNTER(ADDED_BLOCKS, n))
+    #define PROFILE_COUNTER(counter, value) Profiler::instance().setCounter(ProfileCounter::counter, (value))
+    /// Marca el inicio de un frame nuevo
+    #define PROFILE_BEGIN_FRAME() Profiler::instance().beginFrame()
+#else
+    #define PROFILE_SCOPE(stage) ((void)0)
+    #define PROFILE_BEGIN(stage) ((void)0)
+    #define PROFILE_END(stage) ((void)0)
+    #define PROFILE_COUNTER(counter, value) ((void)0)
+    #define PROFILE_BEGIN_FRAME() ((void)0)
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file Trace.hpp
+ * @brief Instrumentación de trazas exportable a Chrome trace / Perfetto
+ *
+ * Registra slices (duración), contadores, eventos instantáneos y flujos
+ * (p.ej. "chunk solicitado en main" -> "chunk generado en el worker") desde
+ * cualquier thread, y los exporta en formato JSON de trace events para
+ * cargarlos en chrome://tracing o ui.perfetto.dev.
+ *
+ * Diseño:
+ * - Un buffer circular por thread, creado en su primer evento
+ * - Escritura sin locks: solo el thread dueño escribe en su buffer
+ * - El volcado lee todos los buffers mientras los threads siguen escribiendo
+ *   (protocolo tipo seqlock: descarta los eventos que pudieron sobrescribirse)
+ * - Al llenarse, cada buffer sobrescribe sus eventos más antiguos
+ *
+ * Compilación:
+ * - Con ENABLE_TRACING definido los macros TRACE_* registran eventos
+ * - Sin ENABLE_TRACING los macros se expanden a nada (coste cero)
+ *
+ * Los nombres de eventos deben ser literales (se guarda solo el puntero).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Trace {
+
+/**
+ * @brief Eventos que caben en el buffer de cada thread antes de sobrescribir
+ */
+constexpr uint32_t BUFFER_CAPACITY = 1u << 16;
+
+/**
+ * @brief Timestamp actual en nanosegundos desde el inicio del proceso
+ */
+uint64_t now();
+
+/**
+ * @brief Nombra el thread actual en la traza
+ * @param name Nombre (literal)
+ */
+void setThreadName(const char* name);
+
+/**
+ * @brief Registra un slice completo
+ * @param name Nombre del slice (literal)
+ * @param startNs Inicio (Trace::now())
+ * @param endNs Fin (Trace::now())
+ */
+void recordSlice(const char* name, uint64_t startNs, uint64_t endNs);
+
+/**
+ * @brief Registra el valor de un contador
+ * @param name Nombre del contador (literal)
+ * @param value Valor
+ */
+void recordCounter(const char* name, int64_t value);
+
+/**
+ * @brief Registra un evento instantáneo
+ * @param name Nombre del evento (literal)
+ */
+void recordInstant(const char* name);
+
+/**
+ * @brief Registra el inicio de un flujo entre threads
+ * @param name Nombre del flujo (literal, igual en inicio y fin)
+ * @param id Identificador que une inicio y fin
+ *
+ * El flujo se ancla al slice abierto en el thread actual.
+ */
+void recordFlowBegin(const char* name, uint64_t id);
+
+/**
+ * @brief Registra el fin de un flujo entre threads
+ * @param name Nombre del flujo (literal)
+ * @param id Identificador usado en recordFlowBegin
+ */
+void recordFlowEnd(const char* name, uint64_t id);
+
+/**
+ * @brief Escribe todos los eventos registrados en formato Chrome trace JSON
+ * @param path Ruta del archivo de salida
+ * @return true si se escribió correctamente
+ *
+ * Se puede llamar en cualquier momento (los threads siguen registrando).
+ */
+bool dump(const char* path);
+
+/**
+ * @class Scope
+ * @brief Slice RAII: registra la duración del scope
+ */
+class Scope {
+public:
+    explicit Scope(const char* name) : m_name(name), m_start(now()) {}
+    ~Scope() { recordSlice(m_name, m_start, now()); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* m_name;
+    uint64_t m_start;
+};
+
+} // namespace Trace
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#ifdef ENABLE_TRACING
+    /// Slice con la duración del resto del scope actual
+    #define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(traceScope_, __LINE__)(name)
+    /// Valor de un contador (se muestra como gráfico en el visor)
+    #define TRACE_COUNTER(name, value) Trace::recordCounter((name), static_cast<int64_t>(value))
+    /// Evento instantáneo
+    #define TRACE_INSTANT(name) Trace::recordInstant(name)
+    /// Inicio de flujo (flecha hacia el TRACE_FLOW_END con el mismo id)
+    #define TRACE_FLOW_BEGIN(name, id) Trace::recordFlowBegin((name), (id))
+    /// Fin de flujo
+    #define TRACE_FLOW_END(name, id) Trace::recordFlowEnd((name), (id))
+    /// Nombre del thread actual
+    #define TRACE_THREAD_NAME(name) Trace::setThreadName(name)
+#else
+    #define TRACE_SCOPE(name) ((void)0)
+    #define TRACE_COUNTER(name, value) ((void)0)
+    #define TRACE_INSTANT(name) ((void)0)
+    #define TRACE_FLOW_BEGIN(name, id) ((void)0)
+    #define TRACE_FLOW_END(name, id) ((void)0)
+    #define TRACE_THREAD_NAME(name) ((void)0)
+#endif
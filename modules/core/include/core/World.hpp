@@ -10,15 +10,20 @@
 #pragma once
 
 #include "core/Chunk.hpp"
+#include "core/WorldSave.hpp"
+#include "core/WorldSnapshot.hpp"
+#include "utils/MPSCQueue.hpp"
 #include <unordered_map>
 #include <memory>
 #include <string>
 #include <random>
+#include <unordered_set>
+#include <span>
 #include <thread>
 #include <mutex>
-#include <condition_variable>
-#include <queue>
 #include <atomic>
+#include <chrono>
+#include <functional>
 
 #include "FastNoiseLite/FastNoiseLite.h"
 
@@ -109,29 +114,35 @@ namespace std {
  *
  * Gestión de chunks:
  * - Carga dinámica: se generan bajo demanda
- * - Descarga automática: se liberan chunks lejanos
+ * - Cache con presupuesto de memoria: los chunks que se dejan atrás siguen
+ *   cargados hasta que el total supera el presupuesto; entonces se descargan
+ *   los menos usados y más lejanos (evictChunks)
+ * - Tier frío: los chunks fuera de la vista sin usar hace COLD_AFTER_TICKS
+ *   se guardan comprimidos (ChunkCodec) y se expanden en un job al volver a pedirse
  * - Almacenamiento en unordered_map para acceso O(1)
  *
  * Rendimiento:
- * - LOAD_RADIUS: chunks alrededor del jugador (9x9 = 81)
- * - UNLOAD_DISTANCE: distancia para liberar chunks
- * - Memoria típica: ~1.3 MB para 81 chunks
+ * - ~7 KB por chunk cargado (índices fijos de 4 KB + bloques sólidos)
+ * - Unos cientos de bytes por chunk frío
+ * - DEFAULT_MEMORY_BUDGET: 64 MB
  */
 class World {
 public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;  ///< Presupuesto de chunks por defecto (bytes)
+
     /**
      * @brief Constructor del mundo
      * @param seed Semilla para generación procedural (0 = aleatoria)
      *
      * Inicializa los generadores de ruido y prepara el mundo vacío.
-     * Inicia el thread de background para generación de chunks.
+     * La generación de chunks usa el JobSystem compartido (se crea aquí si no existe).
      */
     World(uint32_t seed = 0);
 
     /**
-     * @brief Destructor - detiene el thread de background
+     * @brief Destructor - espera a los jobs de generación pendientes
      *
-     * Libera recursos y espera a que el thread de generación termine.
+     * Libera recursos cuando ningún job de generación referencia el mundo.
      */
     ~World();
 
@@ -157,15 +168,73 @@ public:
      *
      * Útil para modificación del terreno por el jugador.
      * Si el chunk no existe, la operación se ignora.
+     * El cambio queda registrado como delta del chunk (ver saveDeltas):
+     * sobrevive a la descarga y se reaplica al regenerarlo.
      */
     void setBlock(int x, int y, int z, BlockType type);
 
+    /**
+     * @brief Guarda la semilla y los bloques modificados (ver WorldSave)
+     * @param path Ruta del archivo
+     * @param bytesWritten Tamaño del archivo resultante (opcional)
+     * @return false si no se pudo escribir
+     *
+     * OPTIMIZACIÓN: Guardado por deltas. El terreno generado no se guarda:
+     * el archivo solo crece con las ediciones y guardar no recorre chunks.
+     */
+    bool saveDeltas(const std::string& path, size_t* bytesWritten = nullptr) const;
+
+    /**
+     * @brief Carga los bloques modificados de un guardado
+     * @param path Ruta del archivo (su semilla debe ser la de este mundo)
+     * @return false si el archivo no se pudo leer o es de otra semilla
+     *
+     * Reemplaza los deltas actuales. Los chunks afectados que ya estaban
+     * cargados (o fríos) se descartan y se regeneran con los deltas nuevos;
+     * si tenían un job en vuelo, su resultado se descarta y se vuelven a pedir.
+     * Solo debe llamarse desde el thread principal.
+     */
+    bool loadDeltas(const std::string& path);
+
+    /**
+     * @brief Vuelca los chunks residentes, los deltas y la vista a un snapshot
+     * @param path Ruta del archivo
+     * @param view Jugador y cámara
+     * @param bytesWritten Tamaño del archivo resultante (opcional)
+     * @return false si no se pudo escribir
+     *
+     * Los chunks cargados se comprimen con ChunkCodec; los fríos se copian
+     * tal cual. Los pedidos sin publicar no se guardan.
+     */
+    bool saveSnapshot(const std::string& path, const WorldSnapshot::ViewState& view,
+                      size_t* bytesWritten = nullptr);
+
+    /**
+     * @brief Restaura los chunks y deltas de un snapshot mapeado
+     * @param snapshot Snapshot abierto (su semilla debe ser la de este mundo)
+     * @return false si es de otra semilla
+     *
+     * OPTIMIZACIÓN: Reanudación instantánea. Cada chunk entra al tier frío
+     * con un memcpy de sus bytes comprimidos, sin descomprimir: se expande
+     * en un job la primera vez que se pide. Las posiciones ya residentes se
+     * conservan. El snapshot puede cerrarse al volver.
+     * Solo debe llamarse desde el thread principal.
+     */
+    bool restoreSnapshot(const WorldSnapshot::MappedSnapshot& snapshot);
+
+    /** @brief Chunks con bloques modificados */
+    size_t getDeltaChunkCount() const { return m_blockDeltas.size(); }
+
+    /** @brief Bloques modificados en total */
+    size_t getDeltaBlockCount() const;
+
     /**
      * @brief Obtiene un chunk (si existe)
      * @param pos Posición del chunk
      * @return Puntero al chunk o nullptr si no existe
      *
      * NO genera el chunk si no existe. Para obtener/generar, usar getChunksAround().
+     * Solo desde el thread principal (el único que modifica m_chunks).
      */
     inline Chunk* getChunk(ChunkPos pos) {
         auto it = m_chunks.find(pos);
@@ -196,31 +265,222 @@ public:
      * @brief Obtiene todos los chunks alrededor de una posición
      * @param center ChunkPos central
      * @param radius Radio en chunks (ej: 3 = 7x7 = 49 chunks)
-     * @return Vector con punteros a los chunks
+     * @param out Vector de salida (se limpia) con punteros a los chunks
      *
      * Genera chunks que no existen y devuelve solo los que están generados.
      * Se usa para obtener los chunks visibles desde una posición.
      */
-    std::vector<Chunk*> getChunksAround(ChunkPos center, int radius);
+    void getChunksAround(ChunkPos center, int radius, std::vector<Chunk*>& out);
+
+    /**
+     * @brief Obtiene los chunks de un conjunto de posiciones
+     * @param positions Posiciones de chunk (ej: el diamante visible de la cámara)
+     * @param out Vector de salida (se limpia) con punteros a los chunks ya generados
+     *
+     * Genera (con jobs en background) los chunks que no existen y devuelve solo los generados.
+     * OPTIMIZACIÓN: out conserva su capacidad entre frames y los temporales
+     * salen de la FrameArena: sin reservas de heap en régimen estable.
+     * Solo debe llamarse desde el thread principal.
+     */
+    void getChunks(std::span<const ChunkPos> positions, std::vector<Chunk*>& out);
+
+    /**
+     * @brief Pide los chunks de un conjunto de posiciones sin devolverlos
+     * @param positions Posiciones de chunk (ej: el diamante de carga)
+     *
+     * Igual que getChunks(positions, out) pero para quien solo necesita que
+     * estén cargados: marca el uso de los existentes (LRU) y pide los que faltan.
+     * Solo debe llamarse desde el thread principal.
+     */
+    void getChunks(std::span<const ChunkPos> positions);
+
+    /**
+     * @brief Pide con alta prioridad los chunks de una región que aún no se ve
+     * @param positions Posiciones en orden de urgencia (ej: la región visible prevista)
+     * @return Cantidad de chunks pedidos
+     *
+     * No devuelve nada: los chunks llegan por processCompletedChunks como los demás.
+     * Solo debe llamarse desde el thread principal.
+     */
+    int prefetchChunks(std::span<const ChunkPos> positions);
+
+    /**
+     * @brief Genera (o expande del tier frío) una región y espera a que esté publicada
+     * @param positions Posiciones de la región (ej: la región de carga inicial)
+     * @param onProgress Llamada (listos, total) cada vez que se publican chunks (opcional)
+     * @return Chunks de la región publicados (todos, salvo que el World se esté destruyendo)
+     *
+     * Para la fase de carga: los jobs se reparten entre todos los workers y
+     * el thread principal ejecuta jobs mientras espera, en lugar de generar
+     * uno por uno. onProgress corre en el thread principal (puede dibujar).
+     * Solo debe llamarse desde el thread principal.
+     */
+    int pregenerateChunks(std::span<const ChunkPos> positions,
+                          const std::function<void(int, int)>& onProgress = {});
+
+    /**
+     * @brief Publica los chunks que terminaron los jobs de generación
+     * @param budgetMs Tiempo máximo de la llamada en ms (siempre publica al menos uno)
+     * @return Cantidad de chunks publicados
+     *
+     * Llamar una vez por frame desde el thread principal. Es el único punto
+     * donde los chunks generados en background entran a m_chunks; los que no
+     * entran en el presupuesto esperan en la cola al siguiente frame.
+     */
+    int processCompletedChunks(double budgetMs);
+
+    /**
+     * @brief Define la región cuyos chunks se renderizan
+     * @param positions Posiciones de chunk (ej: el diamante visible con un chunk de margen)
+     *
+     * Reconstruye el conjunto visible y pide la generación de los faltantes.
+     * Llamar solo cuando la región cambia (la cámara cambia de chunk, zoom o ventana).
+     * Solo debe llamarse desde el thread principal.
+     */
+    void setVisibleRegion(std::span<const ChunkPos> positions);
+
+    /**
+     * @brief Actualiza el conjunto visible (una vez por frame, antes de getVisibleChunks)
+     *
+     * Si se descargaron chunks, reconstruye el conjunto (los chunks nuevos
+     * los agrega processCompletedChunks al publicarlos). En el frame habitual
+     * no toma locks, no busca en el mapa y no reserva memoria.
+     * Solo debe llamarse desde el thread principal.
+     */
+    void updateVisibleSet();
+
+    /**
+     * @brief Chunks generados de la región visible (válidos hasta la próxima descarga)
+     */
+    const std::vector<Chunk*>& getVisibleChunks() const { return m_visibleChunks; }
+
+    /**
+     * @brief Chunks de la región visible que todavía no están generados
+     *
+     * 0 = la región se dibuja completa. Usado por el benchmark para contar
+     * frames con huecos.
+     */
+    size_t getVisibleMissingCount() const { return m_visiblePositions.size() - m_visibleChunks.size(); }
+
+    /**
+     * @brief Descarga chunks hasta volver al presupuesto de memoria
+     * @param center Posición central (cámara)
+     * @param keepDistance Distancia (Chebyshev) dentro de la cual nunca se descarga
+     * @return Cantidad de chunks descargados
+     *
+     * OPTIMIZACIÓN: Cache LRU ponderada por distancia. Mientras el total
+     * residente no supera el presupuesto no descarga nada: volver a una zona
+     * recién visitada no la regenera. Al superarlo descarta primero los
+     * chunks con mayor (usos del reloj sin tocarlos + distancia al centro)
+     * hasta bajar a 7/8 del presupuesto. Si todo lo que excede está dentro
+     * de keepDistance, el presupuesto se supera.
+     * Solo debe llamarse desde el thread principal.
+     */
+    int evictChunks(ChunkPos center, int keepDistance);
+
+    /**
+     * @brief Pasa al tier frío los chunks sin usar fuera de una zona protegida
+     * @param center Posición central (cámara)
+     * @param keepDistance Distancia (Chebyshev) dentro de la cual nunca se comprime
+     * @param budgetMs Tiempo máximo de la llamada en ms (el resto queda para la próxima)
+     * @return Cantidad de chunks comprimidos
+     *
+     * OPTIMIZACIÓN: Tier frío. Un chunk que nadie pidió en COLD_AFTER_TICKS
+     * cambios de región se comprime y libera su Chunk; vuelve a m_chunks
+     * (en un job de alta prioridad) la próxima vez que getChunks o
+     * prefetchChunks lo piden.
+     * Solo debe llamarse desde el thread principal.
+     */
+    int compressIdleChunks(ChunkPos center, int keepDistance, double budgetMs);
+
+    /**
+     * @brief Cambia el presupuesto de memoria de los chunks cargados
+     * @param bytes Máximo de bytes residentes (ver Chunk::getResidentBytes)
+     */
+    void setMemoryBudget(size_t bytes) { m_memoryBudgetBytes = bytes; }
+
+    /** @brief Presupuesto de memoria de los chunks cargados (bytes) */
+    size_t getMemoryBudget() const { return m_memoryBudgetBytes; }
+
+    /** @brief Bytes ocupados por los chunks cargados y los del tier frío */
+    size_t getResidentBytes() const { return m_residentBytes; }
+
+    /** @brief Chunks comprimidos en el tier frío */
+    size_t getColdChunkCount() const { return m_coldChunks.size(); }
+
+    /** @brief Bytes del tier frío (incluidos en getResidentBytes) */
+    size_t getColdBytes() const { return m_coldBytes; }
+
+    /** @brief Chunks expandidos desde el tier frío desde la creación (estadística) */
+    uint32_t getChunksThawed() const { return m_chunksThawed.load(std::memory_order_relaxed); }
+
+    /** @brief Chunks descargados por presupuesto desde la creación (estadística) */
+    uint32_t getChunksEvicted() const { return m_chunksEvicted; }
 
     /**
      * @brief Descarga chunks lejanos para liberar memoria
      * @param center Posición central (jugador)
-     * @param maxDistance Distancia máxima para mantener chunks
+     * @param maxDistance Distancia (Chebyshev) máxima para mantener chunks
      * @return Cantidad de chunks descargados
      *
-     * Usa distancia Manhattan (más rápido que euclidiana).
-     * Libera chunks que están más lejos de maxDistance en cualquier eje.
-     * unique_ptr libera la memoria automáticamente.
+     * Libera los chunks (cargados y del tier frío) que están más lejos de
+     * maxDistance en cualquier eje, sin mirar el presupuesto de memoria.
+     * El juego descarga con evictChunks; esta la usan los benchmarks.
+     * Los chunks vuelven al pool para reutilizarse.
      */
     int unloadChunksFarFrom(ChunkPos center, int maxDistance);
 
+    /**
+     * @brief Obtiene los impostores de horizonte de un conjunto de posiciones
+     * @param positions Posiciones de chunk lejanas (fuera del radio de chunks completos)
+     * @param out Vector de salida (se limpia) con punteros a los impostores disponibles
+     *
+     * OPTIMIZACIÓN: Tier de horizonte barato. Los impostores que faltan se
+     * generan en el momento (solo ruido 2D), hasta IMPOSTOR_GENERATION_BUDGET
+     * por llamada; el resto aparece en frames siguientes.
+     * Solo debe llamarse desde el thread principal.
+     */
+    void getImpostors(const std::vector<ChunkPos>& positions, std::vector<const ImpostorChunk*>& out);
+
+    /**
+     * @brief Descarga impostores lejanos
+     * @param center Posición central (cámara)
+     * @param maxDistance Distancia máxima (Chebyshev) para mantener impostores
+     * @return Cantidad de impostores descargados
+     */
+    int unloadImpostorsFarFrom(ChunkPos center, int maxDistance);
+
     /**
      * @brief Obtiene cantidad de chunks cargados
      * @return Número de chunks en memoria
      */
     size_t getChunkCount() const { return m_chunks.size(); }
 
+    /**
+     * @brief Obtiene cantidad de impostores de horizonte cargados
+     * @return Número de impostores en memoria
+     */
+    size_t getImpostorCount() const { return m_impostors.size(); }
+
+    /**
+     * @brief Chunks generados desde la creación del mundo (estadística)
+     */
+    uint32_t getChunksGenerated() const { return m_chunksGenerated.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Chunks pedidos sin publicar (0 = todo lo pedido ya está cargado)
+     *
+     * Solo desde el thread principal.
+     */
+    int getPendingGenerationCount() const { return static_cast<int>(m_chunksInFlight.size()); }
+
+    /**
+     * @brief Tiempo total invertido en generateTerrain (ms, estadística)
+     */
+    double getGenerationTimeMs() const {
+        return m_generationTimeNs.load(std::memory_order_relaxed) / 1000000.0;
+    }
+
     /**
      * @brief Obtiene la altura del terreno en una posición
      * @param x Coordenada X mundial
@@ -236,7 +496,6 @@ public:
 
 private:
     uint32_t m_seed;                                    ///< Semilla del mundo (determinista)
-    std::mt19937 m_rng;                                 ///< Generador Mersenne Twister para aleatorios
     FastNoiseLiteWrapper m_noiseTerrain;                ///< Ruido para terreno (Perlin + FBM)
     FastNoiseLiteWrapper m_noiseCaves;                  ///< Ruido para cuevas (OpenSimplex2 3D)
     FastNoiseLiteWrapper m_noiseBiome;                  ///< Ruido para biomas (Perlin baja frecuencia)
@@ -246,33 +505,133 @@ private:
     mutable BlockType m_biomeCache[BIOME_CACHE_SIZE];   ///< Cache de biomas por valor de ruido
     mutable std::atomic<bool> m_biomeCacheInitialized{false};  ///< Flag de inicialización (thread-safe)
 
-    // OPTIMIZACIÓN 6: Multithreaded Chunk Generation
-    std::thread m_chunkGeneratorThread;                 ///< Thread de background para generación
-    std::queue<ChunkPos> m_chunkGenerationQueue;        ///< Cola de chunks pendientes de generación
-    std::mutex m_chunkQueueMutex;                       ///< Mutex para proteger la cola
-    std::condition_variable m_chunkQueueCV;             ///< Variable de condición para wakeups
-    std::atomic<bool> m_chunkGeneratorShouldStop;       ///< Flag para detener el thread
+    // OPTIMIZACIÓN 6: Multithreaded Chunk Generation (jobs en el JobSystem compartido)
+    // m_chunks y m_chunksInFlight solo los toca el thread principal: los
+    // workers entregan los chunks terminados por m_completedChunks
+    std::unordered_set<ChunkPos> m_chunksInFlight;      ///< Pedidos sin publicar (job pendiente o chunk en la cola)
+    std::unordered_set<ChunkPos> m_staleInFlight;       ///< Pedidos anteriores a loadDeltas: el resultado se descarta
+    MPSCQueue<std::unique_ptr<Chunk>> m_completedChunks;  ///< Chunks generados esperando publicación (lock-free)
+    std::mutex m_chunkPoolMutex;                        ///< Protege m_chunkPool (workers y thread principal)
+    std::atomic<int> m_generationJobsInFlight{0};       ///< Jobs de generación sin terminar
+    std::atomic<bool> m_chunkGeneratorShouldStop;       ///< Flag para descartar los jobs pendientes
+    std::atomic<uint32_t> m_chunksGenerated{0};         ///< Chunks generados (estadística)
+    std::atomic<uint64_t> m_generationTimeNs{0};        ///< Tiempo acumulado de generación (ns)
+
+    // OPTIMIZACIÓN: Conjunto visible persistente (solo thread principal)
+    std::vector<ChunkPos> m_visiblePositions;           ///< Región visible actual (ordenada, ver chunkPosLess)
+    std::vector<Chunk*> m_visibleChunks;                ///< Chunks publicados de la región
+    bool m_visibleSetDirty = false;                     ///< Reconstruir en el próximo updateVisibleSet (hubo descargas)
+
+    // OPTIMIZACIÓN: Cache LRU de chunks con presupuesto de memoria (solo thread principal)
+    static constexpr size_t CHUNK_POOL_LIMIT = 64;      ///< Chunks inactivos que conserva el pool (el resto se destruye)
+    size_t m_memoryBudgetBytes = DEFAULT_MEMORY_BUDGET; ///< Máximo de bytes residentes antes de descargar
+    size_t m_residentBytes = 0;                         ///< Bytes de los chunks en m_chunks y en m_coldChunks
+    uint32_t m_useClock = 0;                            ///< Avanza con cada cambio de región visible
+    uint32_t m_chunksEvicted = 0;                       ///< Chunks descargados por presupuesto (estadística)
+
+    // OPTIMIZACIÓN: Tier frío comprimido (solo thread principal)
+    static constexpr uint32_t COLD_AFTER_TICKS = 8;     ///< Cambios de región sin uso antes de comprimir
+
+    /**
+     * @brief Chunk comprimido con ChunkCodec
+     */
+    struct ColdChunk {
+        std::vector<uint8_t> data;  ///< Bytes comprimidos (capacidad exacta)
+        uint32_t lastUsed = 0;      ///< Reloj de uso al comprimir (LRU)
+
+        /** @brief Bytes que se descuentan del presupuesto */
+        size_t getResidentBytes() const { return sizeof(ColdChunk) + data.capacity(); }
+    };
+    std::unordered_map<ChunkPos, ColdChunk> m_coldChunks;  ///< Chunks fríos por posición
+    size_t m_coldBytes = 0;                             ///< Bytes de m_coldChunks
+    std::vector<uint8_t> m_compressBuffer;              ///< Buffer reutilizable de compressIdleChunks
+    std::atomic<uint32_t> m_chunksThawed{0};            ///< Chunks expandidos (estadística)
+
+    // OPTIMIZACIÓN: Guardado por deltas (solo thread principal)
+    std::unordered_map<ChunkPos, std::vector<WorldSave::BlockDelta>> m_blockDeltas;  ///< Bloques cambiados por setBlock, por chunk
+
+    /**
+     * @brief Job de generación de un chunk (se ejecuta en un worker)
+     * @param pos Posición del chunk a generar
+     *
+     * Genera el terreno sin locks y lo entrega por m_completedChunks; lo
+     * publica en m_chunks el thread principal (processCompletedChunks).
+     * Si el mundo se está destruyendo, solo descarta el pedido.
+     */
+    void generateChunkJob(ChunkPos pos);
+
+    /**
+     * @brief Job que expande un chunk frío (se ejecuta en un worker)
+     * @param pos Posición del chunk
+     * @param data Bytes comprimidos
+     *
+     * Entrega el chunk por m_completedChunks como generateChunkJob. Si los
+     * datos no se pueden leer, genera el chunk desde el ruido.
+     */
+    void thawChunkJob(ChunkPos pos, const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Descarta un chunk frío (descuenta sus bytes)
+     */
+    void dropColdChunk(std::unordered_map<ChunkPos, ColdChunk>::iterator it);
+
+    /**
+     * @brief Toma un chunk del pool (o crea uno) listo para generar en pos
+     */
+    std::unique_ptr<Chunk> acquireChunk(ChunkPos pos);
+
+    /**
+     * @brief Devuelve un chunk al pool
+     */
+    void releaseChunk(std::unique_ptr<Chunk> chunk);
+
+    /**
+     * @brief Inserta un chunk generado en m_chunks (solo thread principal)
+     * @param chunk Chunk generado
+     *
+     * Enlaza los vecinos para el face culling de los bordes y lo agrega al
+     * conjunto visible si su posición está en la región.
+     */
+    void publishChunk(std::unique_ptr<Chunk> chunk);
 
     /**
-     * @brief Worker thread para generación de chunks en background
+     * @brief Aplica los deltas guardados de un chunk recién generado
+     * @param chunk Chunk generado desde el ruido (o expandido del tier frío)
      *
-     * Este método corre en un thread separado y:
-     * 1. Espera a que haya chunks en la cola
-     * 2. Genera chunks de la cola
-     * 3. Los chunks generados se agregan a m_chunks
+     * Idempotente: un chunk frío ya los contenía y los recibe igual.
+     * Recalcula el heightmap, la superficie y los bounds de las columnas tocadas.
+     */
+    void applyBlockDeltas(Chunk& chunk, const std::vector<WorldSave::BlockDelta>& deltas);
+
+    /**
+     * @brief Copia la superficie de un chunk editado a un impostor
      *
-     * Se detiene cuando m_chunkGeneratorShouldStop es true.
+     * El ruido no conoce las ediciones: los impostores de chunks con deltas
+     * salen de los bloques reales.
+     */
+    static void copySurfaceToImpostor(const Chunk& chunk, ImpostorChunk& impostor);
+
+    /**
+     * @brief Quita un chunk de m_chunks, lo desenlaza de sus vecinos y lo devuelve al pool
+     * @param pos Posición del chunk (si no está cargado no hace nada)
+     */
+    void unloadChunk(ChunkPos pos);
+
+    /**
+     * @brief Recorre la región visible completa y rehace m_visibleChunks
      */
-    void chunkGenerationWorker();
+    void rebuildVisibleSet();
 
     /**
      * @brief Solicita generación asíncrona de un chunk
      * @param pos Posición del chunk a generar
+     * @param highPriority true = job en la cola de alta prioridad (prefetch)
      *
-     * Agrega el chunk a la cola de generación si no existe.
-     * El thread de background lo generará eventualmente.
+     * Programa un job si el chunk no existe ni tiene uno pendiente. Si el
+     * chunk está en el tier frío, el job lo expande en lugar de generarlo
+     * (siempre con alta prioridad: es mucho más barato).
      */
-    void requestChunkGeneration(ChunkPos pos);
+    void requestChunkGeneration(ChunkPos pos, bool highPriority = false);
 
     /**
      * @brief Mapa de chunks cargados
@@ -286,6 +645,7 @@ private:
      *
      * En lugar de crear/destruir chunks constantemente (allocations del heap),
      * los chunks descargados se devuelven a este pool para ser reutilizados.
+     * Limitado a CHUNK_POOL_LIMIT: fuera del presupuesto de memoria.
      *
      * Beneficios:
      * - Elimina allocations/deallocations frecuentes
@@ -294,6 +654,27 @@ private:
      */
     std::vector<std::unique_ptr<Chunk>> m_chunkPool;
 
+    /**
+     * @brief Impostores de horizonte (solo superficie) por posición
+     *
+     * Tier barato para chunks lejanos: altura + bioma por columna, sin bloques.
+     * Solo lo usa el thread principal (no necesita mutex). Las referencias a
+     * los valores de un unordered_map son estables ante rehash.
+     */
+    std::unordered_map<ChunkPos, ImpostorChunk> m_impostors;
+
+    static constexpr int IMPOSTOR_GENERATION_BUDGET = 64;  ///< Impostores nuevos por llamada a getImpostors
+
+    /**
+     * @brief Genera la superficie de un impostor con ruido 2D
+     * @param impostor Impostor a rellenar (position ya establecida)
+     *
+     * Usa la misma altura de terreno y bioma que generateTerrain, pero
+     * sin cuevas, árboles ni storage de bloques. Las posiciones con deltas
+     * (pocas) se generan completas para que el impostor muestre las ediciones.
+     */
+    void generateImpostor(ImpostorChunk& impostor);
+
     /**
      * @brief Inicializa los generadores de ruido con la semilla
      *
@@ -348,5 +729,16 @@ private:
      * - Y > altura: aire
      */
     void generateTerrain(Chunk* chunk);
+
+    /**
+     * @brief Suma un chunk generado a las estadísticas
+     * @param elapsed Duración de generateTerrain
+     */
+    void recordGeneration(std::chrono::steady_clock::duration elapsed) {
+        m_chunksGenerated.fetch_add(1, std::memory_order_relaxed);
+        m_generationTimeNs.fetch_add(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            std::memory_order_relaxed);
+    }
 };
 
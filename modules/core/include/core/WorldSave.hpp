@@ -0,0 +1,96 @@
+/**
+ * @file WorldSave.hpp
+ * @brief Guardado del mundo como deltas sobre la generación procedural
+ *
+ * El terreno sale entero de la semilla: guardar los chunks completos
+ * repetiría lo que el generador reconstruye solo. El archivo guarda la
+ * semilla y, por chunk, únicamente los bloques que cambió World::setBlock.
+ * Al cargar, cada chunk se regenera y se le aplican sus deltas.
+ *
+ * Formato (little-endian):
+ * - Cabecera: magic "IGWS", versión (u16), semilla (u32), cantidad de chunks (u32)
+ * - Por chunk: x (i32), z (i32), cantidad de deltas (u16)
+ * - Por delta: índice local (u16, ver packLocal) y tipo de bloque (u8)
+ *
+ * Un mundo sin ediciones ocupa 14 bytes; cada bloque cambiado, 3.
+ *
+ * No depende de SDL ni del World.
+ */
+
+#pragma once
+
+#include "core/Chunk.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WorldSave {
+
+/**
+ * @struct BlockDelta
+ * @brief Bloque de un chunk que difiere del generado
+ */
+struct BlockDelta {
+    uint16_t index;   ///< Posición local empaquetada (packLocal)
+    BlockType type;   ///< Tipo de bloque colocado
+};
+
+/**
+ * @struct ChunkDelta
+ * @brief Deltas de un chunk
+ */
+struct ChunkDelta {
+    ChunkPos pos;
+    std::vector<BlockDelta> blocks;
+};
+
+/**
+ * @brief Empaqueta coordenadas locales en un índice [0, DenseBlockStorage::MAX_BLOCKS)
+ * @param x, z Coordenadas locales [0, CHUNK_SIZE-1]
+ * @param y Altura [0, WORLD_HEIGHT-1]
+ */
+inline uint16_t packLocal(int x, int y, int z) {
+    return static_cast<uint16_t>((y * BlockConfig::CHUNK_SIZE + z) * BlockConfig::CHUNK_SIZE + x);
+}
+
+/**
+ * @brief Inverso de packLocal
+ */
+inline void unpackLocal(uint16_t index, int& x, int& y, int& z) {
+    x = index % BlockConfig::CHUNK_SIZE;
+    z = (index / BlockConfig::CHUNK_SIZE) % BlockConfig::CHUNK_SIZE;
+    y = index / (BlockConfig::CHUNK_SIZE * BlockConfig::CHUNK_SIZE);
+}
+
+/**
+ * @brief Escribe un archivo de guardado
+ * @param path Ruta del archivo (se reemplaza al terminar de escribir)
+ * @param seed Semilla del mundo
+ * @param chunks Deltas por chunk
+ * @param bytesWritten Tamaño del archivo resultante (opcional)
+ * @return false si no se pudo escribir
+ *
+ * Escribe a un archivo temporal y lo renombra: un guardado interrumpido
+ * no pisa el anterior.
+ */
+bool write(const std::string& path, uint32_t seed, const std::vector<ChunkDelta>& chunks,
+           size_t* bytesWritten = nullptr);
+
+/**
+ * @brief Lee un archivo de guardado completo
+ * @param path Ruta del archivo
+ * @param seed Semilla del mundo guardado
+ * @param chunks Deltas por chunk (se reemplazan)
+ * @return false si el archivo no existe o está corrupto
+ */
+bool read(const std::string& path, uint32_t& seed, std::vector<ChunkDelta>& chunks);
+
+/**
+ * @brief Lee solo la semilla de un archivo de guardado
+ * @return false si el archivo no existe o la cabecera no es válida
+ *
+ * La semilla se necesita para crear el World antes de leer los deltas.
+ */
+bool readSeed(const std::string& path, uint32_t& seed);
+
+} // namespace WorldSave
@@ -0,0 +1,171 @@
+/**
+ * @file WorldSnapshot.hpp
+ * @brief Snapshot del mundo residente para reanudar al instante
+ *
+ * Al salir se vuelcan los chunks residentes (cargados y fríos), los deltas
+ * de bloques y la posición del jugador y la cámara. Al volver a arrancar el
+ * archivo se mapea en memoria y se usa en su lugar: las tablas se leen sin
+ * copiar y cada chunk pasa al tier frío del World con un único memcpy de
+ * sus bytes comprimidos. Nada se descomprime al arrancar: los chunks se
+ * expanden en jobs a medida que se piden, así que el costo de reanudar casi
+ * no depende de cuántos chunks había cargados.
+ *
+ * Formato (orden de bytes nativo, little-endian en todas las plataformas
+ * soportadas; todas las secciones alineadas a ALIGNMENT):
+ * - Header (72 bytes)
+ * - Tabla de chunks: Header::chunkCount ChunkEntry
+ * - Tabla de deltas: Header::deltaCount DeltaRecord
+ * - Datos de los chunks (formato ChunkCodec), cada uno alineado
+ *
+ * Una versión distinta de VERSION se rechaza: el snapshot es una caché del
+ * estado y se vuelve a generar al salir. Un archivo dañado (checksum
+ * distinto, vista no finita o chunks que ChunkCodec no acepta) hace que se
+ * regenere desde la semilla.
+ */
+
+#pragma once
+
+#include "core/Chunk.hpp"
+#include "utils/MappedFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace WorldSnapshot {
+
+constexpr char MAGIC[4] = {'I', 'G', 'S', 'N'};
+constexpr uint16_t VERSION = 3;  ///< 3: chunks en ChunkCodec v2
+constexpr uint32_t ALIGNMENT = 16;  ///< Alineación de las secciones y de cada chunk
+
+/**
+ * @struct ViewState
+ * @brief Estado del jugador y la cámara a restaurar
+ */
+struct ViewState {
+    float playerX = 0.0f, playerY = 0.0f, playerZ = 0.0f;
+    float cameraX = 0.0f, cameraY = 0.0f, cameraZ = 0.0f;
+    float zoom = 1.0f;
+};
+
+/**
+ * @struct Header
+ * @brief Cabecera del archivo
+ */
+struct Header {
+    char magic[4];
+    uint16_t version;
+    uint16_t headerSize;        ///< sizeof(Header)
+    uint32_t seed;
+    uint32_t chunkCount;
+    uint32_t deltaCount;
+    uint32_t chunkTableOffset;  ///< Offset de la tabla de chunks (bytes desde el inicio)
+    uint32_t deltaTableOffset;  ///< Offset de la tabla de deltas
+    ViewState view;
+    uint64_t fileSize;          ///< Tamaño total (detecta archivos truncados)
+    uint32_t checksum;          ///< FNV-1a del archivo completo con este campo en 0
+    uint32_t reserved;          ///< 0
+};
+
+/**
+ * @struct ChunkEntry
+ * @brief Entrada de la tabla de chunks
+ */
+struct ChunkEntry {
+    int32_t x, z;
+    uint32_t offset;  ///< Offset de los datos comprimidos
+    uint32_t size;    ///< Bytes comprimidos
+};
+
+/**
+ * @struct DeltaRecord
+ * @brief Bloque modificado (ver WorldSave::BlockDelta)
+ */
+struct DeltaRecord {
+    int32_t x, z;      ///< Chunk
+    uint16_t index;    ///< Posición local empaquetada (WorldSave::packLocal)
+    uint8_t type;      ///< BlockType
+    uint8_t reserved;  ///< 0
+};
+
+static_assert(sizeof(ViewState) == 28, "ViewState cambió: subir VERSION");
+static_assert(sizeof(Header) == 72, "Header cambió: subir VERSION");
+static_assert(sizeof(ChunkEntry) == 16, "ChunkEntry cambió: subir VERSION");
+static_assert(sizeof(DeltaRecord) == 12, "DeltaRecord cambió: subir VERSION");
+
+/**
+ * @struct ChunkData
+ * @brief Chunk comprimido a escribir
+ */
+struct ChunkData {
+    ChunkPos pos;
+    std::span<const uint8_t> data;  ///< Bytes de ChunkCodec::compress
+};
+
+/**
+ * @brief Escribe un snapshot
+ * @param path Ruta del archivo (se reemplaza al terminar de escribir)
+ * @param seed Semilla del mundo
+ * @param view Jugador y cámara
+ * @param chunks Chunks comprimidos
+ * @param deltas Bloques modificados
+ * @param bytesWritten Tamaño del archivo resultante (opcional)
+ * @return false si no se pudo escribir
+ */
+bool write(const std::string& path, uint32_t seed, const ViewState& view,
+           std::span<const ChunkData> chunks, std::span<const DeltaRecord> deltas,
+           size_t* bytesWritten = nullptr);
+
+/**
+ * @class MappedSnapshot
+ * @brief Snapshot abierto en memoria mapeada (lectura sin copias)
+ *
+ * Los punteros que devuelve son válidos mientras el snapshot esté abierto.
+ */
+class MappedSnapshot {
+public:
+    /**
+     * @brief Mapea y valida un snapshot
+     * @param path Ruta del archivo
+     * @return false si no existe, es de otra versión, está truncado o dañado
+     *
+     * Valida la cabecera, el checksum, la vista (valores finitos y zoom
+     * positivo) y que las tablas y todos los chunks estén dentro del archivo.
+     * El contenido de cada chunk lo valida ChunkCodec::decompress al
+     * expandirlo: si lo rechaza, el chunk se regenera desde el ruido.
+     */
+    bool open(const std::string& path);
+
+    void close() {
+        m_file.close();
+        m_header = nullptr;
+        m_chunks = {};
+        m_deltas = {};
+    }
+
+    bool isOpen() const { return m_header != nullptr; }
+
+    uint32_t getSeed() const { return m_header->seed; }
+    const ViewState& getView() const { return m_header->view; }
+
+    /** @brief Tamaño del archivo mapeado (bytes) */
+    size_t getFileSize() const { return m_file.size(); }
+
+    /** @brief Tabla de chunks (en el mapeo) */
+    std::span<const ChunkEntry> getChunks() const { return m_chunks; }
+
+    /** @brief Bloques modificados (en el mapeo) */
+    std::span<const DeltaRecord> getDeltas() const { return m_deltas; }
+
+    /** @brief Bytes comprimidos de un chunk de la tabla (en el mapeo) */
+    const uint8_t* getChunkData(const ChunkEntry& entry) const { return m_file.data() + entry.offset; }
+
+private:
+    MappedFile m_file;
+    const Header* m_header = nullptr;
+    std::span<const ChunkEntry> m_chunks;
+    std::span<const DeltaRecord> m_deltas;
+};
+
+} // namespace WorldSnapshot
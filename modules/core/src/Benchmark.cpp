@@ -0,0 +1,151 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementación del recorrido scriptado y del reporte del benchmark
+ */
+
+#include "core/Benchmark.hpp"
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Tramo del recorrido: input constante durante una cantidad de frames
+ */
+struct ScriptSegment {
+    int frames;
+    BenchmarkInput input;
+};
+
+constexpr ScriptSegment SCRIPT[] = {
+    {60,  {0, 0, 0}},    // Calentamiento: generación inicial alrededor del spawn
+    {480, {1, 0, 0}},    // Este
+    {120, {0, 0, -1}},   // Alejar zoom (más chunks visibles)
+    {480, {0, 1, 0}},    // Sur
+    {240, {-1, 0, 1}},   // Oeste acercando zoom
+    {480, {-1, 0, 0}},   // Oeste
+    {120, {0, 0, 1}},    // Acercar zoom
+    {480, {0, -1, 0}},   // Norte
+};
+
+constexpr int computeLoopLength() {
+    int total = 0;
+    for (const ScriptSegment& segment : SCRIPT) {
+        total += segment.frames;
+    }
+    return total;
+}
+
+constexpr int LOOP_LENGTH = computeLoopLength();
+
+/**
+ * @brief Percentil por rango más cercano sobre valores ya ordenados
+ */
+float percentile(const std::vector<float>& sorted, float p) {
+    if (sorted.empty()) {
+        return 0.0f;
+    }
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5f);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+} // namespace
+
+BenchmarkInput BenchmarkScript::getInput(int frame) {
+    int local = frame % LOOP_LENGTH;
+    for (const ScriptSegment& segment : SCRIPT) {
+        if (local < segment.frames) {
+            return segment.input;
+        }
+        local -= segment.frames;
+    }
+    return BenchmarkInput{};
+}
+
+int BenchmarkScript::getLoopLength() {
+    return LOOP_LENGTH;
+}
+
+namespace Benchmark {
+
+size_t getPeakMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<size_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    #ifdef __APPLE__
+        return static_cast<size_t>(usage.ru_maxrss);         // bytes
+    #else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;  // KB
+    #endif
+#endif
+}
+
+void writeResultsJson(const BenchmarkResults& results, std::ostream& out) {
+    std::vector<float> sorted = results.frameTimesMs;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (float ms : sorted) {
+        sum += ms;
+    }
+    const size_t frames = sorted.size();
+    const double mean = frames ? sum / frames : 0.0;
+    const double chunksPerSecond = results.wallTimeSeconds > 0.0
+        ? results.chunksGenerated / results.wallTimeSeconds : 0.0;
+    const double msPerChunk = results.chunksGenerated
+        ? results.generationMs / results.chunksGenerated : 0.0;
+
+    char buffer[1536];
+    std::snprintf(buffer, sizeof(buffer),
+        "{\n"
+        "  \"benchmark\": \"scripted_flight\",\n"
+        "  \"seed\": %u,\n"
+        "  \"frames\": %zu,\n"
+        "  \"headless\": %s,\n"
+        "  \"wall_time_s\": %.3f,\n"
+        "  \"frame_ms\": {\"mean\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f},\n"
+        "  \"chunk_generation\": {\"chunks\": %u, \"chunks_per_s\": %.1f, \"ms_per_chunk\": %.3f},\n"
+        "  \"missing_chunks\": {\"prefetch\": %s, \"frames\": %u, \"frames_pct\": %.2f},\n"
+        "  \"chunk_cache\": {\"budget_mb\": %.1f, \"resident_mb\": %.1f, \"evicted\": %u, "
+        "\"cold_chunks\": %zu, \"cold_mb\": %.2f, \"thawed\": %u},\n"
+        "  \"startup\": {\"chunks\": %d, \"load_ms\": %.1f, \"time_to_first_frame_ms\": %.1f},\n"
+        "  \"peak_memory_mb\": %.1f\n"
+        "}\n",
+        results.seed, frames, results.headless ? "true" : "false",
+        results.wallTimeSeconds,
+        mean, percentile(sorted, 0.50f), percentile(sorted, 0.95f), percentile(sorted, 0.99f),
+        frames ? sorted.back() : 0.0f,
+        results.chunksGenerated, chunksPerSecond, msPerChunk,
+        results.prefetch ? "true" : "false", results.framesWithMissingChunks,
+        frames ? 100.0 * results.framesWithMissingChunks / frames : 0.0,
+        results.chunkBudgetBytes / (1024.0 * 1024.0), results.chunkResidentBytes / (1024.0 * 1024.0),
+        results.chunksEvicted,
+        results.coldChunks, results.coldBytes / (1024.0 * 1024.0), results.chunksThawed,
+        results.startupChunks, results.startupLoadMs, results.timeToFirstFrameMs,
+        results.peakMemoryBytes / (1024.0 * 1024.0));
+
+    out << buffer;
+}
+
+} // namespace Benchmark
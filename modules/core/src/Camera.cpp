@@ -8,6 +8,7 @@
 
 #include "core/Camera.hpp"
 #include <cmath>
+#include <algorithm>
 
 /**
  * @brief Constructor de la cámara
@@ -258,3 +259,72 @@ void Camera::setCenter(float centerX, float centerY) {
     m_centerX = centerX;
     m_centerY = centerY;
 }
+
+/**
+ * @brief Calcula los chunks que pueden aparecer en pantalla
+ * @param screenWidth, screenHeight Tamaño de la pantalla (píxeles)
+ * @param marginChunks Anillo extra de chunks (prefetch de carga)
+ * @param maxRadius Radio máximo en chunks desde la cámara
+ * @param out Vector de salida con las posiciones visibles
+ *
+ * Algoritmo:
+ * 1. Ampliar el rectángulo de pantalla con el tamaño del sprite más grande
+ *    (árboles de 2 tiles de ancho) para no perder sprites que entran por los bordes.
+ * 2. Proyectar inversamente las 4 esquinas a Y=0 y a Y=WORLD_HEIGHT.
+ * 3. Como screenX depende solo de u = x - z y screenY de v = x + z (más la altura),
+ *    el área visible es un rectángulo [minU, maxU] x [minV, maxV] en espacio (u, v).
+ * 4. Un chunk con esquina (x0, z0) cubre u en [x0-z0-S, x0-z0+S] y v en [x0+z0, x0+z0+2S]
+ *    (S = CHUNK_SIZE); es visible si ambos intervalos se solapan con la vista.
+ * 5. Limitar a maxRadius (Chebyshev) alrededor del chunk de la cámara.
+ */
+void Camera::getVisibleChunks(int screenWidth, int screenHeight, int marginChunks, int maxRadius,
+                              std::vector<ChunkPos>& out) const {
+    out.clear();
+
+    const float padding = IsoConfig::TILE_WIDTH * 2.0f * m_zoom;
+    const float cornersX[2] = {-padding, screenWidth + padding};
+    const float cornersY[2] = {-padding, screenHeight + padding};
+    const float heights[2] = {0.0f, static_cast<float>(BlockConfig::WORLD_HEIGHT)};
+
+    float minU = 1e30f, maxU = -1e30f, minV = 1e30f, maxV = -1e30f;
+    for (float sx : cornersX) {
+        for (float sy : cornersY) {
+            for (float h : heights) {
+                float wx, wz;
+                screenToWorld(sx, sy, wx, wz, h);
+                minU = std::min(minU, wx - wz);
+                maxU = std::max(maxU, wx - wz);
+                minV = std::min(minV, wx + wz);
+                maxV = std::max(maxV, wx + wz);
+            }
+        }
+    }
+
+    // El margen se expresa en chunks: un chunk en X/Z equivale a 2*S en u y v
+    const float marginUV = static_cast<float>(marginChunks * BlockConfig::CHUNK_SIZE * 2);
+    minU -= marginUV; maxU += marginUV;
+    minV -= marginUV; maxV += marginUV;
+
+    // Caja envolvente en X/Z: x = (u + v) / 2, z = (v - u) / 2
+    const float S = static_cast<float>(BlockConfig::CHUNK_SIZE);
+    const int camChunkX = static_cast<int>(std::floor(m_posX / S));
+    const int camChunkZ = static_cast<int>(std::floor(m_posZ / S));
+    const int minCX = std::max(camChunkX - maxRadius, static_cast<int>(std::floor((minU + minV) * 0.5f / S)));
+    const int maxCX = std::min(camChunkX + maxRadius, static_cast<int>(std::floor((maxU + maxV) * 0.5f / S)));
+    const int minCZ = std::max(camChunkZ - maxRadius, static_cast<int>(std::floor((minV - maxU) * 0.5f / S)));
+    const int maxCZ = std::min(camChunkZ + maxRadius, static_cast<int>(std::floor((maxV - minU) * 0.5f / S)));
+
+    for (int cx = minCX; cx <= maxCX; cx++) {
+        for (int cz = minCZ; cz <= maxCZ; cz++) {
+            const float x0 = cx * S;
+            const float z0 = cz * S;
+            const float u = x0 - z0;
+            const float v = x0 + z0;
+
+            if (u + S < minU || u - S > maxU || v + 2.0f * S < minV || v > maxV) {
+                continue;  // Fuera del diamante visible
+            }
+            out.emplace_back(cx, cz);
+        }
+    }
+}
@@ -108,6 +108,7 @@ const Block& Chunk::getBlock(int x, int y, int z) const {
  * @param y Coordenada Y (altura) [0, WORLD_HEIGHT-1]
  * @param z Coordenada Z local [0, CHUNK_SIZE-1]
  * @param type Tipo de bloque a establecer
+ * @param variant Variante visual del bloque
  *
  * OPTIMIZACIÓN MEDIA #4: DENSE ARRAY STORAGE
  * - Si type == AIRE, marca como AIR_MARK
@@ -119,7 +120,7 @@ const Block& Chunk::getBlock(int x, int y, int z) const {
  * - Modificación del terreno por el jugador (colocar bloques)
  * - Actualizaciones del mundo (cavar, construir)
  */
-void Chunk::setBlock(int x, int y, int z, BlockType type) {
+void Chunk::setBlock(int x, int y, int z, BlockType type, uint8_t variant) {
     // Validar coordenadas locales
     if (x < 0 || x >= BlockConfig::CHUNK_SIZE ||
         z < 0 || z >= BlockConfig::CHUNK_SIZE ||
@@ -131,7 +132,46 @@ void Chunk::setBlock(int x, int y, int z, BlockType type) {
     size_t index = getIndex(x, y, z);
 
     // OPTIMIZACIÓN MEDIA #4: Set directo por índice (maneja AIRE internamente)
-    m_blocks.set(index, type);
+    m_blocks.set(index, type, variant);
+}
+
+/**
+ * @brief Recalcula el heightmap y la superficie de una columna
+ *
+ * Busca el bloque sólido más alto de la columna. Si es un árbol apoyado
+ * sobre un bloque sólido, la superficie es el bloque de abajo y el árbol su
+ * decoración (como en generateTerrain); si no, la superficie es ese bloque.
+ */
+void Chunk::refreshColumn(int x, int z) {
+    int top = BlockConfig::WORLD_HEIGHT - 1;
+    while (top >= 0 && !getBlockUnsafe(x, top, z).esSolido()) {
+        top--;
+    }
+
+    SurfaceColumn surface;
+    if (top < 0) {
+        // Columna vacía: heightmap a 0 y superficie AIRE
+        setMaxY(x, z, 0);
+        setSurface(x, z, surface);
+        return;
+    }
+
+    const BlockType topType = getBlockUnsafe(x, top, z).type;
+    const bool isTree = topType == BlockType::ARBOL_SECO ||
+                        topType == BlockType::ARBOL_GRASS ||
+                        topType == BlockType::ARBOL_SANGRE;
+    if (isTree && top > 0 && getBlockUnsafe(x, top - 1, z).esSolido()) {
+        surface.groundType = getBlockUnsafe(x, top - 1, z).type;
+        surface.groundY = static_cast<uint8_t>(top - 1);
+        surface.topType = topType;
+        surface.topVariant = getVariantUnsafe(x, top, z);
+    } else {
+        surface.groundType = topType;
+        surface.groundY = static_cast<uint8_t>(top);
+    }
+
+    setMaxY(x, z, top);
+    setSurface(x, z, surface);
 }
 
 /**
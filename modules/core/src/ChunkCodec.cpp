@@ -0,0 +1,200 @@
+/**
+ * @file ChunkCodec.cpp
+ * @brief Implementación de la compresión paleta + RLE de chunks
+ */
+
+#include "core/ChunkCodec.hpp"
+#include <array>
+
+namespace {
+
+constexpr uint8_t FORMAT_VERSION = 2;  ///< 2: heightmap en el mismo orden que la superficie
+constexpr int COLUMNS = BlockConfig::CHUNK_SIZE * BlockConfig::CHUNK_SIZE;
+constexpr size_t MAX_PALETTE = 256;
+
+/** @brief Par (tipo, variante) empaquetado en 16 bits: clave de la paleta */
+inline uint16_t blockKey(BlockType type, uint8_t variant) {
+    return static_cast<uint16_t>((static_cast<uint16_t>(type) << 8) | variant);
+}
+
+void writeVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+/** @brief Tipo y variante leídos del archivo dentro de los rangos del juego */
+inline bool isValidBlock(uint8_t type, uint8_t variant) {
+    return type < static_cast<uint8_t>(BlockType::TOTAL_TIPOS) && variant < RenderVariants::MAX_VARIANTS;
+}
+
+bool readVarint(const uint8_t*& cursor, const uint8_t* end, uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        if (cursor >= end) return false;
+        const uint8_t byte = *cursor++;
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+namespace ChunkCodec {
+
+bool compress(const Chunk& chunk, std::vector<uint8_t>& out) {
+    out.clear();
+    out.push_back(FORMAT_VERSION);
+
+    // Heightmap y superficie en el orden de sus arrays (x + z * CHUNK_SIZE)
+    for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+        for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+            out.push_back(static_cast<uint8_t>(chunk.getMaxY(x, z)));
+        }
+    }
+    for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+        for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+            const SurfaceColumn& surface = chunk.getSurface(x, z);
+            out.push_back(static_cast<uint8_t>(surface.groundType));
+            out.push_back(static_cast<uint8_t>(surface.topType));
+            out.push_back(surface.groundY);
+            out.push_back(surface.topVariant);
+        }
+    }
+
+    // Paleta en orden de aparición y runs (el tamaño de la paleta se
+    // escribe delante: los runs se arman en un buffer aparte)
+    std::array<uint16_t, MAX_PALETTE> palette{};
+    size_t paletteSize = 0;
+    const size_t paletteOffset = out.size();
+    out.push_back(0);  // Cantidad, se completa al final
+
+    // Primera pasada: construir la paleta
+    std::array<uint8_t, DenseBlockStorage::MAX_BLOCKS> entries{};
+    size_t index = 0;
+    uint16_t lastKey = 0;
+    size_t lastEntry = MAX_PALETTE;
+    for (int y = 0; y < BlockConfig::WORLD_HEIGHT; y++) {
+        for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+            for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+                const uint16_t key = blockKey(chunk.getBlockUnsafe(x, y, z).type, chunk.getVariantUnsafe(x, y, z));
+
+                // Dentro de un run la entrada se repite: sin buscar en la paleta
+                if (lastEntry == MAX_PALETTE || key != lastKey) {
+                    size_t entry = 0;
+                    while (entry < paletteSize && palette[entry] != key) {
+                        entry++;
+                    }
+                    if (entry == paletteSize) {
+                        if (paletteSize == MAX_PALETTE) {
+                            return false;
+                        }
+                        palette[paletteSize++] = key;
+                    }
+                    lastKey = key;
+                    lastEntry = entry;
+                }
+                entries[index++] = static_cast<uint8_t>(lastEntry);
+            }
+        }
+    }
+
+    out[paletteOffset] = static_cast<uint8_t>(paletteSize);  // 256 se escribe como 0
+    for (size_t i = 0; i < paletteSize; i++) {
+        out.push_back(static_cast<uint8_t>(palette[i] >> 8));
+        out.push_back(static_cast<uint8_t>(palette[i] & 0xFF));
+    }
+
+    // Segunda pasada: runs
+    size_t runStart = 0;
+    for (size_t i = 1; i <= entries.size(); i++) {
+        if (i == entries.size() || entries[i] != entries[runStart]) {
+            out.push_back(entries[runStart]);
+            writeVarint(out, static_cast<uint32_t>(i - runStart));
+            runStart = i;
+        }
+    }
+    return true;
+}
+
+bool decompress(const uint8_t* data, size_t size, Chunk& chunk) {
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+
+    if (size < 1 + COLUMNS + COLUMNS * 4 + 1 || *cursor++ != FORMAT_VERSION) {
+        return false;
+    }
+
+    // Todo lo que se lee se valida: los datos pueden venir de un archivo
+    // (WorldSnapshot) y los índices terminan en tablas del renderer
+    for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+        for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+            if (*cursor >= BlockConfig::WORLD_HEIGHT) {
+                return false;
+            }
+            chunk.setMaxY(x, z, *cursor++);
+        }
+    }
+    for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+        for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+            if (!isValidBlock(cursor[0], 0) || !isValidBlock(cursor[1], cursor[3]) ||
+                cursor[2] >= BlockConfig::WORLD_HEIGHT) {
+                return false;
+            }
+            SurfaceColumn surface;
+            surface.groundType = static_cast<BlockType>(cursor[0]);
+            surface.topType = static_cast<BlockType>(cursor[1]);
+            surface.groundY = cursor[2];
+            surface.topVariant = cursor[3];
+            cursor += 4;
+            chunk.setSurface(x, z, surface);
+        }
+    }
+    chunk.updateHeightBounds();
+
+    const size_t paletteSize = (*cursor == 0) ? MAX_PALETTE : *cursor;
+    cursor++;
+    if (static_cast<size_t>(end - cursor) < paletteSize * 2) {
+        return false;
+    }
+    std::array<uint16_t, MAX_PALETTE> palette{};
+    for (size_t i = 0; i < paletteSize; i++) {
+        if (!isValidBlock(cursor[0], cursor[1])) {
+            return false;
+        }
+        palette[i] = static_cast<uint16_t>((cursor[0] << 8) | cursor[1]);
+        cursor += 2;
+    }
+
+    size_t index = 0;
+    while (index < DenseBlockStorage::MAX_BLOCKS) {
+        if (cursor >= end) return false;
+        const uint8_t entry = *cursor++;
+        uint32_t length = 0;
+        if (entry >= paletteSize || !readVarint(cursor, end, length) ||
+            length == 0 || index + length > DenseBlockStorage::MAX_BLOCKS) {
+            return false;
+        }
+
+        const BlockType type = static_cast<BlockType>(palette[entry] >> 8);
+        const uint8_t variant = static_cast<uint8_t>(palette[entry] & 0xFF);
+        if (type == BlockType::AIRE) {
+            index += length;  // El chunk llega vacío: el aire no se escribe
+            continue;
+        }
+        for (uint32_t i = 0; i < length; i++, index++) {
+            const int x = static_cast<int>(index % BlockConfig::CHUNK_SIZE);
+            const int z = static_cast<int>((index / BlockConfig::CHUNK_SIZE) % BlockConfig::CHUNK_SIZE);
+            const int y = static_cast<int>(index / (BlockConfig::CHUNK_SIZE * BlockConfig::CHUNK_SIZE));
+            chunk.setBlockUnsafe(x, y, z, type, variant);
+        }
+    }
+
+    chunk.setGenerated(true);
+    return true;
+}
+
+} // namespace ChunkCodec
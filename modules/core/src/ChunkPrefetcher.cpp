@@ -0,0 +1,82 @@
+/**
+ * @file ChunkPrefetcher.cpp
+ * @brief Implementación del prefetch predictivo de chunks
+ */
+
+#include "core/ChunkPrefetcher.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+void ChunkPrefetcher::addSample(float x, float z, float deltaTime) {
+    m_time += deltaTime;
+    m_samples[m_next] = Sample{x, z, m_time};
+    m_next = (m_next + 1) % HISTORY_SIZE;
+    m_count = std::min(m_count + 1, HISTORY_SIZE);
+
+    // Velocidad media de la ventana: (más nueva - más vieja) / tiempo entre ambas.
+    // El movimiento es de a un bloque por tick: una diferencia de un solo tick
+    // oscilaría entre 0 y la velocidad real
+    const Sample& newest = m_samples[(m_next + HISTORY_SIZE - 1) % HISTORY_SIZE];
+    const Sample& oldest = m_samples[(m_next + HISTORY_SIZE - m_count) % HISTORY_SIZE];
+    const float elapsed = newest.time - oldest.time;
+    if (elapsed > 0.0f) {
+        m_velocityX = (newest.x - oldest.x) / elapsed;
+        m_velocityZ = (newest.z - oldest.z) / elapsed;
+    } else {
+        m_velocityX = m_velocityZ = 0.0f;
+    }
+}
+
+void ChunkPrefetcher::reset() {
+    m_next = 0;
+    m_count = 0;
+    m_velocityX = m_velocityZ = 0.0f;
+}
+
+bool ChunkPrefetcher::isMoving() const {
+    return m_velocityX * m_velocityX + m_velocityZ * m_velocityZ >= MIN_SPEED * MIN_SPEED;
+}
+
+ChunkPos ChunkPrefetcher::getLookaheadChunks() const {
+    if (!isMoving()) {
+        return ChunkPos(0, 0);
+    }
+
+    float dx = m_velocityX * LOOKAHEAD_SECONDS / BlockConfig::CHUNK_SIZE;
+    float dz = m_velocityZ * LOOKAHEAD_SECONDS / BlockConfig::CHUNK_SIZE;
+
+    // Escalar (sin cambiar la dirección) si excede el límite
+    const float reach = std::max(std::abs(dx), std::abs(dz));
+    if (reach > MAX_LOOKAHEAD_CHUNKS) {
+        dx *= MAX_LOOKAHEAD_CHUNKS / reach;
+        dz *= MAX_LOOKAHEAD_CHUNKS / reach;
+    }
+    return ChunkPos(static_cast<int>(std::lround(dx)), static_cast<int>(std::lround(dz)));
+}
+
+void ChunkPrefetcher::getPredictedChunks(const Camera& camera, int screenWidth, int screenHeight,
+                                         int marginChunks, int maxRadius, std::vector<ChunkPos>& out) const {
+    out.clear();
+    const ChunkPos ahead = getLookaheadChunks();
+    if (ahead.x == 0 && ahead.z == 0) {
+        return;
+    }
+
+    float camX, camY, camZ;
+    camera.getPosition(camX, camY, camZ);
+
+    Camera predicted = camera;
+    predicted.setPosition(camX + ahead.x * BlockConfig::CHUNK_SIZE, camY,
+                          camZ + ahead.z * BlockConfig::CHUNK_SIZE);
+    predicted.getVisibleChunks(screenWidth, screenHeight, marginChunks, maxRadius, out);
+
+    // Los más cercanos a la cámara actual son los que entran antes en pantalla
+    const ChunkPos current = BlockUtils::worldToChunk(static_cast<int>(std::floor(camX)),
+                                                      static_cast<int>(std::floor(camZ)));
+    std::sort(out.begin(), out.end(), [current](const ChunkPos& a, const ChunkPos& b) {
+        const int distA = std::max(std::abs(a.x - current.x), std::abs(a.z - current.z));
+        const int distB = std::max(std::abs(b.x - current.x), std::abs(b.z - current.z));
+        return distA < distB;
+    });
+}
@@ -0,0 +1,99 @@
+/**
+ * @file FramePacer.cpp
+ * @brief Implementación del limitador de frames adaptativo
+ */
+
+#include "core/FramePacer.hpp"
+#include "core/Trace.hpp"
+#include <algorithm>
+#include <thread>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #include <mmsystem.h>
+#endif
+
+FramePacer::FramePacer(int targetFps) {
+#ifdef _WIN32
+    timeBeginPeriod(1);
+#endif
+    setTargetFps(targetFps);
+}
+
+FramePacer::~FramePacer() {
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
+}
+
+void FramePacer::setTargetFps(int targetFps) {
+    m_targetFps = std::max(0, targetFps);
+    m_period = (m_targetFps > 0)
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / m_targetFps))
+        : Clock::duration::zero();
+
+    // Reiniciar el deadline: el primer frame tras el cambio se mide desde ahora
+    m_frameStart = Clock::now();
+    m_deadline = m_frameStart + m_period;
+}
+
+void FramePacer::waitForNextFrame() {
+    const Clock::time_point workEnd = Clock::now();
+    m_lastWorkMs = std::chrono::duration<float, std::milli>(workEnd - m_frameStart).count();
+    m_frameCount++;
+
+    if (m_targetFps <= 0) {
+        m_frameStart = workEnd;
+        return;
+    }
+
+    if (workEnd >= m_deadline) {
+        // Deadline perdido: no recuperar el atraso, el siguiente frame
+        // dispone de un periodo completo desde ahora
+        m_missedDeadlines++;
+        TRACE_INSTANT("missed deadline");
+        m_frameStart = workEnd;
+        m_deadline = workEnd + m_period;
+        return;
+    }
+
+    TRACE_SCOPE("FramePacer::wait");
+
+    // Fase 1: sleep hasta el deadline menos el margen de spin. El exceso
+    // del sleep respecto de lo pedido ajusta el margen (media móvil hacia
+    // arriba rápida, hacia abajo lenta: pasarse cuesta un deadline)
+    const auto sleepTarget = m_deadline - std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::micro>(m_spinMarginUs));
+    Clock::time_point now = workEnd;
+    if (sleepTarget > now) {
+        const auto requested = sleepTarget - now;
+        std::this_thread::sleep_for(requested);
+        now = Clock::now();
+
+        const double overshootUs = std::chrono::duration<double, std::micro>(now - sleepTarget).count();
+        const double wantedMargin = overshootUs + MIN_SPIN_MARGIN_US;
+        const double rate = (wantedMargin > m_spinMarginUs) ? 0.5 : 0.05;
+        m_spinMarginUs += (wantedMargin - m_spinMarginUs) * rate;
+        m_spinMarginUs = std::clamp(m_spinMarginUs, MIN_SPIN_MARGIN_US, MAX_SPIN_MARGIN_US);
+    }
+
+    // Fase 2: spin hasta el deadline (cede el núcleo entre comprobaciones)
+    while (now < m_deadline) {
+        std::this_thread::yield();
+        now = Clock::now();
+    }
+
+    // Deadlines contiguos: la frecuencia media es exacta aunque cada espera
+    // termine unos microsegundos tarde
+    m_frameStart = now;
+    m_deadline += m_period;
+    if (m_deadline <= now) {
+        m_deadline = now + m_period;
+    }
+}
@@ -1,7 +1,18 @@
 #include "core/Game.hpp"
+#include "core/Profiler.hpp"
+#include "core/Trace.hpp"
+#include "core/WorldSave.hpp"
+#include "core/WorldSnapshot.hpp"
+#include "utils/JobSystem.hpp"
+#include "utils/FrameArena.hpp"
+#include "utils/AllocationCounter.hpp"
 #include <iostream>
 #include <chrono>
 #include <cmath>  // Para std::floor
+#include <algorithm>  // Para std::max
+#include <cstdio>  // Para std::snprintf
+#include <ctime>  // Para std::time
+#include <fstream>
 
 Game::Game()
     : m_window(nullptr)
@@ -10,6 +21,7 @@ Game::Game()
     , m_camera(nullptr)
     , m_lastFrameTime(0)
     , m_lastChunkPos(0, 0)      // Inicializar en origen (0, 0)
+    , m_lastPrefetchChunkPos(0, 0)
     , m_lastChunkUpdateTime(0) // Inicializar timer de estadísticas
 {
 }
@@ -18,7 +30,10 @@ Game::~Game() {
     // Cleanup es llamado explícitamente en main.cpp
 }
 
-bool Game::init() {
+bool Game::init(const GameConfig& config) {
+    m_initStart = std::chrono::steady_clock::now();
+    m_config = config;
+
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL no pudo inicializarse: " << SDL_GetError() << std::endl;
         return false;
@@ -29,7 +44,7 @@ bool Game::init() {
         SDL_WINDOWPOS_CENTERED,
         SDL_WINDOWPOS_CENTERED,
         1280, 720,
-        SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE
+        (m_config.headless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN) | SDL_WINDOW_RESIZABLE
     );
 
     if (!m_window) {
@@ -43,69 +58,401 @@ bool Game::init() {
         return false;
     }
 
-    uint32_t seed = static_cast<uint32_t>(std::time(nullptr));
+    // Reproducción: la semilla y el tamaño de ventana salen del log
+    if (!m_config.replayInputPath.empty()) {
+        m_inputReplayer = std::make_unique<InputReplayer>();
+        if (!m_inputReplayer->open(m_config.replayInputPath)) {
+            std::cerr << "No se pudo abrir el log de input: " << m_config.replayInputPath << std::endl;
+            return false;
+        }
+        m_config.seed = m_inputReplayer->getSeed();
+        m_config.hasSeed = true;
+        m_config.benchmark = false;  // El input viene del log, no del recorrido scriptado
+        SDL_SetWindowSize(m_window, m_inputReplayer->getWidth(), m_inputReplayer->getHeight());
+        if (m_inputReplayer->getTickRate() > 0) {
+            m_config.tickRate = m_inputReplayer->getTickRate();  // Mismos ticks que la sesión grabada
+        }
+        std::cout << "Reproduciendo input de " << m_config.replayInputPath << std::endl;
+    }
+
+    // Guardado: la semilla sale del archivo (los deltas se aplican sobre ese terreno)
+    if (!m_config.loadPath.empty()) {
+        if (!WorldSave::readSeed(m_config.loadPath, m_config.seed)) {
+            std::cerr << "No se pudo leer el guardado: " << m_config.loadPath << std::endl;
+            return false;
+        }
+        m_config.hasSeed = true;
+    }
+
+    // Snapshot: reanudar la sesión anterior (la semilla sale del archivo).
+    // Benchmark, verificación, grabación y reproducción necesitan un arranque
+    // repetible: el log de input solo guarda la semilla, no el estado restaurado
+    if (m_config.benchmark || m_config.checkAllocs || !m_config.replayInputPath.empty() ||
+        !m_config.recordInputPath.empty()) {
+        m_config.snapshotPath.clear();
+    }
+    WorldSnapshot::MappedSnapshot snapshot;
+    if (!m_config.snapshotPath.empty() && m_config.loadPath.empty() && snapshot.open(m_config.snapshotPath)) {
+        m_config.seed = snapshot.getSeed();
+        m_config.hasSeed = true;
+    }
+
+    m_config.tickRate = std::max(1, m_config.tickRate);
+    m_tickDelta = 1.0f / m_config.tickRate;
+    m_framePacer.setTargetFps(m_config.targetFps);
+
+    // Semilla fija (benchmark/reproducción) o aleatoria
+    uint32_t seed = m_config.hasSeed ? m_config.seed : static_cast<uint32_t>(std::time(nullptr));
     m_world = std::make_unique<World>(seed);
+    m_world->setMemoryBudget(static_cast<size_t>(m_config.chunkBudgetMB) * 1024 * 1024);
+    if (!m_config.loadPath.empty()) {
+        if (!m_world->loadDeltas(m_config.loadPath)) {
+            std::cerr << "Guardado corrupto: " << m_config.loadPath << std::endl;
+            return false;
+        }
+        std::cout << "Guardado cargado de " << m_config.loadPath << ": "
+                  << m_world->getDeltaBlockCount() << " bloques modificados" << std::endl;
+    }
+    if (snapshot.isOpen()) {
+        auto restoreStart = std::chrono::steady_clock::now();
+        m_world->restoreSnapshot(snapshot);
+        double restoreMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - restoreStart).count();
+        std::cout << "Snapshot restaurado de " << m_config.snapshotPath << ": "
+                  << m_world->getColdChunkCount() << " chunks en " << restoreMs << " ms" << std::endl;
+    }
+    std::cout << "Semilla del mundo: " << seed << std::endl;
+    std::cout << "Presupuesto de chunks: " << m_config.chunkBudgetMB << " MB" << std::endl;
 
     m_camera = std::make_unique<Camera>();
-    m_camera->setZoom(2.0f);
+    m_camera->setZoom(snapshot.isOpen() ? snapshot.getView().zoom : 2.0f);
+
+    SDL_GetWindowSize(m_window, &m_viewportWidth, &m_viewportHeight);
+    m_camera->setCenter(m_viewportWidth / 2.0f, m_viewportHeight / 2.0f);
 
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(m_window, &windowWidth, &windowHeight);
-    m_camera->setCenter(windowWidth / 2.0f, windowHeight / 2.0f);
+    // Al reanudar, la primera región de carga ya es la de la sesión anterior
+    if (snapshot.isOpen()) {
+        const WorldSnapshot::ViewState& view = snapshot.getView();
+        m_camera->setPosition(view.cameraX, view.cameraY, view.cameraZ);
+    }
 
+    if (!m_config.recordInputPath.empty()) {
+        if (m_inputRecorder.open(m_config.recordInputPath, seed, m_viewportWidth, m_viewportHeight,
+                                 m_config.tickRate)) {
+            std::cout << "Grabando input en " << m_config.recordInputPath << std::endl;
+        } else {
+            std::cerr << "No se pudo crear el log de input: " << m_config.recordInputPath << std::endl;
+        }
+    }
+
+    // Cámara sobre la columna de spawn: la altura sale del ruido (el chunk
+    // todavía no existe) y se corrige al ubicar al jugador
+    if (!snapshot.isOpen()) {
+        m_camera->setPosition(0.0f, static_cast<float>(m_world->getTerrainHeight(0, 0) + 1), 0.0f);
+    }
+
+    pregenerateStartArea();
     updateChunks();
 
     m_player = std::make_unique<Player>(0.0f, 0.0f, 0.0f);
-    m_player->spawnOnSurface(m_world.get());
+    if (snapshot.isOpen()) {
+        const WorldSnapshot::ViewState& view = snapshot.getView();
+        m_player->setPosition(view.playerX, view.playerY, view.playerZ);
+        snapshot.close();  // Los chunks ya se copiaron al tier frío
+    } else {
+        m_player->spawnOnSurface(m_world.get());
+
+        float playerX, playerY, playerZ;
+        m_player->getPosition(playerX, playerY, playerZ);
+        m_camera->setPosition(playerX, playerY, playerZ);
+    }
 
-    float playerX, playerY, playerZ;
-    m_player->getPosition(playerX, playerY, playerZ);
-    m_camera->setPosition(playerX, playerY, playerZ);
+    // Resolver handles de sprites una vez (sin búsquedas por nombre en cada frame)
+    m_playerSprite = m_renderer->getSpriteHandle(m_player->getTileName());
+
+    m_currRenderState = captureRenderState();
+    m_prevRenderState = m_currRenderState;
+    m_tickAccumulator = 0.0;
 
     return true;
 }
 
+void Game::pregenerateStartArea() {
+    TRACE_SCOPE("Game::pregenerateStartArea");
+    const auto start = std::chrono::steady_clock::now();
+
+    m_camera->getVisibleChunks(m_viewportWidth, m_viewportHeight, LOAD_MARGIN,
+                               MAX_RENDER_RADIUS + LOAD_MARGIN, m_loadChunkPositions);
+
+    // Pantalla de carga: el redibujo se limita a LOADING_REDRAW_MS para que
+    // el thread principal pase el resto del tiempo generando
+    Uint64 lastDraw = 0;
+    m_startupChunks = m_world->pregenerateChunks(m_loadChunkPositions, [this, &lastDraw](int ready, int total) {
+        const Uint64 now = SDL_GetTicks64();
+        if (ready < total && now - lastDraw < LOADING_REDRAW_MS) {
+            return;
+        }
+        lastDraw = now;
+        SDL_PumpEvents();  // La ventana sigue respondiendo durante la carga
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "Generando mundo... %d / %d", ready, total);
+        m_renderer->clear();
+        m_renderer->drawProgressBar(total > 0 ? static_cast<float>(ready) / total : 1.0f, label);
+        m_renderer->present();
+    });
+
+    m_startupLoadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Área inicial: " << m_startupChunks << " chunks en " << m_startupLoadMs << " ms ("
+              << JobSystem::instance().getWorkerCount() + 1 << " threads)" << std::endl;
+}
+
 void Game::run() {
     m_lastFrameTime = SDL_GetTicks64();
     m_fpsUpdateTime = m_lastFrameTime;
 
+    TRACE_THREAD_NAME("main");
+
+    // Modo benchmark: medir cada frame con el contador de alta resolución
+    const Uint64 perfFrequency = SDL_GetPerformanceFrequency();
+    const Uint64 benchmarkStart = SDL_GetPerformanceCounter();
+    Uint64 frameStart = benchmarkStart;
+    int benchmarkFrame = 0;
+    if (m_config.benchmark) {
+        m_benchmarkFrameTimes.reserve(m_config.benchmarkFrames);
+        m_benchmarkStartChunks = m_world->getChunksGenerated();
+        m_benchmarkStartGenerationMs = m_world->getGenerationTimeMs();
+        m_benchmarkStartEvicted = m_world->getChunksEvicted();
+        m_benchmarkStartThawed = m_world->getChunksThawed();
+        std::cout << "Benchmark: " << m_config.benchmarkFrames << " frames" << std::endl;
+    }
+    int frameIndex = 0;
+    if (m_config.checkAllocs) {
+        std::cout << "Verificando reservas de heap: " << m_config.benchmarkFrames << " frames" << std::endl;
+    }
+
     while (m_state.running) {
+        PROFILE_BEGIN_FRAME();
+        TRACE_SCOPE("frame");
+
+        // OPTIMIZACIÓN: Los temporales del frame anterior se liberan de golpe
+        FrameArena::instance().reset();
+        const uint64_t frameAllocStart = AllocationCounter::getThreadAllocations();
+
         // Calcular deltaTime
         Uint64 currentTime = SDL_GetTicks64();
         float deltaTime = (currentTime - m_lastFrameTime) / 1000.0f;
         m_lastFrameTime = currentTime;
 
+        // En benchmark la simulación avanza con paso fijo: la misma semilla
+        // y el mismo recorrido producen la misma carga en cada ejecución
+        if (m_config.benchmark) {
+            deltaTime = BenchmarkScript::FIXED_DELTA_TIME;
+        }
+
+        // Reproducción: deltaTime y eventos grabados para este frame
+        if (m_inputReplayer && !m_inputReplayer->nextFrame(deltaTime, m_replayEvents)) {
+            std::cout << "Reproducción terminada (" << m_inputReplayer->getFrameCount()
+                      << " frames)" << std::endl;
+            break;
+        }
+
         // FPS Counter: Calcular FPS cada segundo
         m_frameCount++;
         if (currentTime - m_fpsUpdateTime >= 1000) {
             m_currentFPS = m_frameCount;
+            m_averageFrameMs = static_cast<float>(currentTime - m_fpsUpdateTime) / m_frameCount;
             m_frameCount = 0;
             m_fpsUpdateTime = currentTime;
         }
 
-        // Procesar input
+        // Procesar input (grabando los eventos del frame si corresponde)
+        if (m_inputRecorder.isOpen()) {
+            m_inputRecorder.beginFrame(deltaTime);
+        }
         handleInput();
+        if (!m_inputRecorder.endFrame()) {
+            std::cerr << "Frame con más de " << InputRecorder::MAX_FRAME_EVENTS
+                      << " eventos: grabación de input detenida tras " << m_inputRecorder.getFrameCount()
+                      << " frames" << std::endl;
+        }
+        if (m_config.benchmark) {
+            applyBenchmarkInput(benchmarkFrame);
+        }
+        if (m_config.checkAllocs) {
+            // Cámara quieta: tras la carga inicial el frame no debería reservar nada
+            m_state.moveUp = m_state.moveDown = m_state.moveLeft = m_state.moveRight = false;
+            m_state.zoomIn = m_state.zoomOut = false;
+        }
+
+        // Jobs que deben correr en este thread (SDL, estado del Game)
+        JobSystem::instance().runMainThreadJobs();
+
+        // Publicar los chunks generados en background (con presupuesto de tiempo)
+        m_world->processCompletedChunks(CHUNK_PUBLISH_BUDGET_MS);
 
-        // Actualizar lógica
+        // Actualizar lógica a paso fijo (0..N ticks según el tiempo acumulado)
+        float alpha = 1.0f;
         if (!m_state.paused) {
-            update(deltaTime);
+            alpha = simulate(deltaTime);
+        } else {
+            m_lastTickCount = 0;
+        }
+
+        // Renderizar el estado interpolado entre los dos últimos ticks
+        render(alpha);
+
+        // Primer frame jugable: la vista se dibujó completa
+        if (m_timeToFirstFrameMs == 0.0 && m_world->getVisibleMissingCount() == 0) {
+            m_timeToFirstFrameMs = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - m_initStart).count();
+            std::cout << "Primer frame jugable: " << m_timeToFirstFrameMs << " ms desde el inicio" << std::endl;
+        }
+
+        if (m_config.benchmark) {
+            if (m_world->getVisibleMissingCount() > 0) {
+                m_benchmarkMissingFrames++;
+            }
+
+            Uint64 frameEnd = SDL_GetPerformanceCounter();
+            m_benchmarkFrameTimes.push_back(
+                static_cast<float>((frameEnd - frameStart) * 1000.0 / perfFrequency));
+            frameStart = frameEnd;
+
+            if (++benchmarkFrame >= m_config.benchmarkFrames) {
+                m_state.running = false;
+            }
+        }
+
+        // Esperar al deadline del frame (sin límite en modo benchmark)
+        m_framePacer.waitForNextFrame();
+
+        if (m_config.checkAllocs) {
+            recordFrameAllocations(frameIndex, AllocationCounter::getThreadAllocations() - frameAllocStart);
+            if (frameIndex + 1 >= m_config.benchmarkFrames) {
+                m_state.running = false;
+            }
+        }
+        frameIndex++;
+    }
+
+    if (m_config.checkAllocs) {
+        const FrameArena& arena = FrameArena::instance();
+        std::cout << "Reservas de heap: " << m_allocFailedFrames << " de " << m_allocCheckedFrames
+                  << " frames estables (máximo " << m_allocMaxPerFrame << " por frame)" << std::endl;
+        std::cout << "FrameArena: pico " << arena.getPeakBytes() << " bytes, capacidad "
+                  << arena.getCapacity() << " bytes, desbordes " << arena.getOverflowCount() << std::endl;
+        if (m_allocCheckedFrames == 0) {
+            std::cout << "Ningún frame estable: aumentar --frames" << std::endl;
+            m_allocFailedFrames = 1;  // Sin frames verificados la comprobación no pasa
+        }
+    }
+
+    if (m_framePacer.getTargetFps() > 0) {
+        std::cout << "Deadlines perdidos: " << m_framePacer.getMissedDeadlines() << " de "
+                  << m_framePacer.getFrameCount() << " frames a " << m_framePacer.getTargetFps()
+                  << " FPS" << std::endl;
+    }
+
+    if (m_config.benchmark) {
+        writeBenchmarkResults((frameStart - benchmarkStart) / static_cast<double>(perfFrequency));
+    }
+}
+
+void Game::recordFrameAllocations(int frame, uint64_t allocations) {
+    // Carga inicial: los chunks y las capacidades de los caches todavía crecen
+    if (frame < ALLOC_CHECK_WARMUP_FRAMES || m_world->getPendingGenerationCount() > 0) {
+        return;
+    }
+
+    m_allocCheckedFrames++;
+    if (allocations > 0) {
+        if (m_allocFailedFrames == 0) {
+            std::cout << "Frame " << frame << ": " << allocations << " reservas de heap" << std::endl;
         }
+        m_allocFailedFrames++;
+        m_allocMaxPerFrame = std::max(m_allocMaxPerFrame, allocations);
+    }
+}
 
-        // Renderizar
-        render();
+void Game::applyBenchmarkInput(int frame) {
+    const BenchmarkInput input = BenchmarkScript::getInput(frame);
 
-        // Sin límite de FPS - rendimiento máximo
-        // (comentado para permitir FPS ilimitado)
-        // Uint64 frameTime = SDL_GetTicks64() - currentTime;
-        // if (frameTime < FRAME_DELAY) {
-        //     SDL_Delay(FRAME_DELAY - frameTime);
-        // }
+    m_state.paused = false;
+    m_state.moveLeft = (input.moveX < 0);
+    m_state.moveRight = (input.moveX > 0);
+    m_state.moveUp = (input.moveZ < 0);
+    m_state.moveDown = (input.moveZ > 0);
+    m_state.zoomOut = (input.zoom < 0);
+    m_state.zoomIn = (input.zoom > 0);
+}
+
+void Game::writeBenchmarkResults(double wallTimeSeconds) {
+    BenchmarkResults results;
+    results.seed = m_world->getSeed();
+    results.headless = m_config.headless;
+    results.wallTimeSeconds = wallTimeSeconds;
+    results.frameTimesMs = m_benchmarkFrameTimes;
+    results.chunksGenerated = m_world->getChunksGenerated() - m_benchmarkStartChunks;
+    results.generationMs = m_world->getGenerationTimeMs() - m_benchmarkStartGenerationMs;
+    results.peakMemoryBytes = Benchmark::getPeakMemoryBytes();
+    results.prefetch = m_config.prefetch;
+    results.framesWithMissingChunks = m_benchmarkMissingFrames;
+    results.chunkBudgetBytes = m_world->getMemoryBudget();
+    results.chunkResidentBytes = m_world->getResidentBytes();
+    results.chunksEvicted = m_world->getChunksEvicted() - m_benchmarkStartEvicted;
+    results.coldChunks = m_world->getColdChunkCount();
+    results.coldBytes = m_world->getColdBytes();
+    results.chunksThawed = m_world->getChunksThawed() - m_benchmarkStartThawed;
+    results.startupChunks = m_startupChunks;
+    results.startupLoadMs = m_startupLoadMs;
+    results.timeToFirstFrameMs = m_timeToFirstFrameMs;
+
+    Benchmark::writeResultsJson(results, std::cout);
+
+    if (!m_config.benchmarkOutput.empty()) {
+        std::ofstream file(m_config.benchmarkOutput);
+        if (file) {
+            Benchmark::writeResultsJson(results, file);
+            std::cout << "Resultados guardados en " << m_config.benchmarkOutput << std::endl;
+        } else {
+            std::cerr << "No se pudo escribir " << m_config.benchmarkOutput << std::endl;
+        }
     }
 }
 
 void Game::cleanup() {
+    if (m_inputRecorder.isOpen()) {
+        std::cout << "Input grabado: " << m_inputRecorder.getFrameCount() << " frames" << std::endl;
+        m_inputRecorder.close();
+    }
+
+    // Snapshot para reanudar la próxima sesión donde quedó esta
+    if (!m_config.snapshotPath.empty() && m_world && m_player && m_camera) {
+        WorldSnapshot::ViewState view;
+        m_player->getPosition(view.playerX, view.playerY, view.playerZ);
+        m_camera->getPosition(view.cameraX, view.cameraY, view.cameraZ);
+        view.zoom = m_camera->getZoom();
+
+        size_t snapshotBytes = 0;
+        if (m_world->saveSnapshot(m_config.snapshotPath, view, &snapshotBytes)) {
+            std::cout << "Snapshot guardado en " << m_config.snapshotPath << ": "
+                      << (m_world->getChunkCount() + m_world->getColdChunkCount()) << " chunks, "
+                      << snapshotBytes / 1024 << " KB" << std::endl;
+        } else {
+            std::cerr << "Error al guardar el snapshot en " << m_config.snapshotPath << std::endl;
+        }
+    }
+
     m_renderer.reset();
-    m_world.reset();
+    m_world.reset();  // Espera sus jobs en curso (el JobSystem sigue vivo): su traza queda completa
+
+#ifdef ENABLE_TRACING
+    // Volcar la sesión completa al salir
+    if (Trace::dump("trace_exit.json")) {
+        std::cout << "Traza guardada en trace_exit.json" << std::endl;
+    }
+#endif
     m_camera.reset();
     m_player.reset();
 
@@ -118,103 +465,273 @@ void Game::cleanup() {
 }
 
 void Game::handleInput() {
+    PROFILE_SCOPE(INPUT);
+    TRACE_SCOPE("handleInput");
     SDL_Event event;
 
     while (SDL_PollEvent(&event)) {
-        switch (event.type) {
-            case SDL_QUIT:
+        if (m_inputReplayer) {
+            // Reproduciendo: el input real se ignora salvo para salir
+            if (event.type == SDL_QUIT ||
+                (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE)) {
                 m_state.running = false;
-                break;
-
-            case SDL_KEYDOWN:
-                switch (event.key.keysym.sym) {
-                    case SDLK_ESCAPE:
-                        m_state.running = false;
-                        break;
-
-                    // Movimiento de cámara
-                    case SDLK_w:
-                        m_state.moveUp = true;
-                        break;
-                    case SDLK_s:
-                        m_state.moveDown = true;
-                        break;
-                    case SDLK_a:
-                        m_state.moveLeft = true;
-                        break;
-                    case SDLK_d:
-                        m_state.moveRight = true;
-                        break;
-
-                    // Salto con ESPACIO
-                    case SDLK_SPACE:
-                        m_player->tryJump(m_world.get());
-                        break;
-
-                    // Control de zoom
-                    case SDLK_PLUS:
-                    case SDLK_KP_PLUS:
-                        m_state.zoomIn = true;
-                        break;
-
-                    case SDLK_MINUS:
-                    case SDLK_KP_MINUS:
-                        m_state.zoomOut = true;
-                        break;
-
-                    case SDLK_p:
-                        m_state.paused = !m_state.paused;
-                        break;
-                }
-                break;
-
-            case SDL_KEYUP:
-                switch (event.key.keysym.sym) {
-                    case SDLK_w:
-                        m_state.moveUp = false;
-                        break;
-                    case SDLK_s:
-                        m_state.moveDown = false;
-                        break;
-                    case SDLK_a:
-                        m_state.moveLeft = false;
-                        break;
-                    case SDLK_d:
-                        m_state.moveRight = false;
-                        break;
-
-                    // Control de zoom - liberar teclas
-                    case SDLK_PLUS:
-                    case SDLK_KP_PLUS:
-                        m_state.zoomIn = false;
-                        break;
-
-                    case SDLK_MINUS:
-                    case SDLK_KP_MINUS:
-                        m_state.zoomOut = false;
-                        break;
+            }
+            continue;
+        }
+
+        recordInputEvent(event);
+        handleEvent(event);
+    }
+
+    // Entregar los eventos grabados en este frame (mismo orden y mismo frame)
+    if (m_inputReplayer) {
+        for (const InputEvent& recorded : m_replayEvents) {
+            SDL_Event replayed{};
+            switch (recorded.type) {
+                case InputEventType::KEY_DOWN:
+                case InputEventType::KEY_UP:
+                    replayed.type = (recorded.type == InputEventType::KEY_DOWN) ? SDL_KEYDOWN : SDL_KEYUP;
+                    replayed.key.keysym.sym = static_cast<SDL_Keycode>(recorded.a);
+                    break;
+                case InputEventType::RESIZE:
+                    replayed.type = SDL_WINDOWEVENT;
+                    replayed.window.event = SDL_WINDOWEVENT_RESIZED;
+                    replayed.window.data1 = recorded.a;
+                    replayed.window.data2 = recorded.b;
+                    SDL_SetWindowSize(m_window, recorded.a, recorded.b);
+                    break;
+                case InputEventType::QUIT:
+                    replayed.type = SDL_QUIT;
+                    break;
+            }
+            handleEvent(replayed);
+        }
+    }
+}
+
+void Game::recordInputEvent(const SDL_Event& event) {
+    if (!m_inputRecorder.isOpen()) {
+        return;
+    }
+
+    InputEvent recorded;
+    switch (event.type) {
+        case SDL_QUIT:
+            recorded.type = InputEventType::QUIT;
+            break;
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            recorded.type = (event.type == SDL_KEYDOWN) ? InputEventType::KEY_DOWN : InputEventType::KEY_UP;
+            recorded.a = static_cast<int32_t>(event.key.keysym.sym);
+            break;
+        case SDL_WINDOWEVENT:
+            if (event.window.event != SDL_WINDOWEVENT_RESIZED) {
+                return;
+            }
+            recorded.type = InputEventType::RESIZE;
+            recorded.a = event.window.data1;
+            recorded.b = event.window.data2;
+            break;
+        default:
+            return;  // Eventos que no afectan a la simulación
+    }
+    m_inputRecorder.record(recorded);
+}
+
+void Game::handleEvent(const SDL_Event& event) {
+    switch (event.type) {
+        case SDL_QUIT:
+            m_state.running = false;
+            break;
+
+        case SDL_KEYDOWN:
+            switch (event.key.keysym.sym) {
+                case SDLK_ESCAPE:
+                    m_state.running = false;
+                    break;
+
+                // Movimiento de cámara
+                case SDLK_w:
+                    m_state.moveUp = true;
+                    break;
+                case SDLK_s:
+                    m_state.moveDown = true;
+                    break;
+                case SDLK_a:
+                    m_state.moveLeft = true;
+                    break;
+                case SDLK_d:
+                    m_state.moveRight = true;
+                    break;
+
+                // Salto con ESPACIO
+                case SDLK_SPACE:
+                    m_state.jumpRequested = true;
+                    break;
+
+                // Control de zoom
+                case SDLK_PLUS:
+                case SDLK_KP_PLUS:
+                    m_state.zoomIn = true;
+                    break;
+
+                case SDLK_MINUS:
+                case SDLK_KP_MINUS:
+                    m_state.zoomOut = true;
+                    break;
+
+                case SDLK_p:
+                    m_state.paused = !m_state.paused;
+                    break;
+
+                // Guardar las ediciones (deltas sobre la generación procedural)
+                case SDLK_F5: {
+                    auto saveStart = std::chrono::steady_clock::now();
+                    size_t saveBytes = 0;
+                    if (m_world->saveDeltas(m_config.savePath, &saveBytes)) {
+                        double saveMs = std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - saveStart).count();
+                        std::cout << "Mundo guardado en " << m_config.savePath << ": "
+                                  << m_world->getDeltaBlockCount() << " bloques, "
+                                  << saveBytes << " bytes, " << saveMs << " ms" << std::endl;
+                    } else {
+                        std::cerr << "Error al guardar el mundo en " << m_config.savePath << std::endl;
+                    }
+                    break;
                 }
-                break;
-
-            case SDL_WINDOWEVENT:
-                if (event.window.event == SDL_WINDOWEVENT_RESIZED) {
-                    // Actualizar centro de la cámara cuando se redimensiona la ventana
-                    int newWidth = event.window.data1;
-                    int newHeight = event.window.data2;
-                    m_camera->setCenter(newWidth / 2.0f, newHeight / 2.0f);
+
+#ifdef ENABLE_TRACING
+                // Volcar la traza actual (Chrome trace JSON)
+                case SDLK_F4: {
+                    char tracePath[64];
+                    std::snprintf(tracePath, sizeof(tracePath), "trace_%d.json", m_traceDumpCount++);
+                    if (Trace::dump(tracePath)) {
+                        std::cout << "Traza guardada en " << tracePath << std::endl;
+                    } else {
+                        std::cerr << "Error al guardar la traza en " << tracePath << std::endl;
+                    }
+                    break;
                 }
-                break;
-        }
+#endif
+
+#ifdef ENABLE_PROFILER
+                // Mostrar/ocultar el gráfico del profiler
+                case SDLK_F3:
+                    m_showProfiler = !m_showProfiler;
+                    break;
+#endif
+            }
+            break;
+
+        case SDL_KEYUP:
+            switch (event.key.keysym.sym) {
+                case SDLK_w:
+                    m_state.moveUp = false;
+                    break;
+                case SDLK_s:
+                    m_state.moveDown = false;
+                    break;
+                case SDLK_a:
+                    m_state.moveLeft = false;
+                    break;
+                case SDLK_d:
+                    m_state.moveRight = false;
+                    break;
+
+                // Control de zoom - liberar teclas
+                case SDLK_PLUS:
+                case SDLK_KP_PLUS:
+                    m_state.zoomIn = false;
+                    break;
+
+                case SDLK_MINUS:
+                case SDLK_KP_MINUS:
+                    m_state.zoomOut = false;
+                    break;
+            }
+            break;
+
+        case SDL_WINDOWEVENT:
+            if (event.window.event == SDL_WINDOWEVENT_RESIZED) {
+                // Actualizar centro de la cámara cuando se redimensiona la ventana
+                m_viewportWidth = event.window.data1;
+                m_viewportHeight = event.window.data2;
+                m_camera->setCenter(m_viewportWidth / 2.0f, m_viewportHeight / 2.0f);
+                m_viewportDirty = true;  // La forma del conjunto visible cambió
+                m_visibleRegionDirty = true;
+            }
+            break;
+    }
+}
+
+float Game::simulate(float frameDelta) {
+    m_tickAccumulator += frameDelta;
+
+    int ticks = 0;
+    while (m_tickAccumulator >= m_tickDelta && ticks < MAX_TICKS_PER_FRAME) {
+        // La cámara quedó con el estado interpolado del último render:
+        // cada tick parte del estado simulado
+        m_camera->setZoom(m_currRenderState.zoom);
+        m_camera->setPosition(m_currRenderState.playerX, m_currRenderState.playerY,
+                              m_currRenderState.playerZ);
+
+        m_prevRenderState = m_currRenderState;
+        update(m_tickDelta);
+        m_currRenderState = captureRenderState();
+
+        m_tickAccumulator -= m_tickDelta;
+        ticks++;
+    }
+
+    // Pico de render: descartar el atraso en lugar de acumularlo
+    if (m_tickAccumulator >= m_tickDelta) {
+        m_tickAccumulator = std::fmod(m_tickAccumulator, static_cast<double>(m_tickDelta));
     }
+
+    m_lastTickCount = ticks;
+    return static_cast<float>(m_tickAccumulator / m_tickDelta);
+}
+
+SimRenderState Game::captureRenderState() const {
+    SimRenderState state;
+    m_player->getPosition(state.playerX, state.playerY, state.playerZ);
+    state.zoom = m_camera->getZoom();
+    return state;
+}
+
+void Game::applyRenderState(float alpha, float& playerX, float& playerY, float& playerZ) {
+    const SimRenderState& from = m_prevRenderState;
+    const SimRenderState& to = m_currRenderState;
+
+    playerX = from.playerX + (to.playerX - from.playerX) * alpha;
+    playerY = from.playerY + (to.playerY - from.playerY) * alpha;
+    playerZ = from.playerZ + (to.playerZ - from.playerZ) * alpha;
+
+    m_camera->setPosition(playerX, playerY, playerZ);
+    m_camera->setZoom(from.zoom + (to.zoom - from.zoom) * alpha);
 }
 
 void Game::update(float deltaTime) {
-    // Actualizar física del jugador (gravedad)
-    m_player->update(deltaTime, m_world.get());
+    TRACE_SCOPE("update");
+
+    // Actualizar física del jugador (salto pendiente y gravedad)
+    {
+        PROFILE_SCOPE(PLAYER_UPDATE);
+        if (m_state.jumpRequested) {
+            m_player->tryJump(m_world.get());
+            m_state.jumpRequested = false;
+        }
+        m_player->update(deltaTime, m_world.get());
+    }
 
     // Actualizar posición de la cámara
     updateCamera(deltaTime);
 
+    // Historial de posiciones para estimar la velocidad (prefetch predictivo)
+    float camX, camY, camZ;
+    m_camera->getPosition(camX, camY, camZ);
+    m_prefetcher.addSample(camX, camZ, deltaTime);
+
     // Cargar/descargar chunks según posición de la cámara
     updateChunks();
 }
@@ -262,6 +779,8 @@ void Game::updateCamera(float deltaTime) {
 }
 
 void Game::updateChunks() {
+    PROFILE_SCOPE(UPDATE_CHUNKS);
+
     // Obtener posición actual de la cámara en coordenadas mundiales
     float camX, camY, camZ;
     m_camera->getPosition(camX, camY, camZ);
@@ -276,46 +795,144 @@ void Game::updateChunks() {
     int totalMovement = distX + distZ;
 
     // Solo procesar carga/descarga si nos movimos suficientemente
+    // o si cambió la forma del conjunto visible (zoom o tamaño de ventana).
     // Esto evita procesamiento innecesario cuando el jugador está quieto
-    if (totalMovement >= MOVEMENT_THRESHOLD) {
-        // Paso 1: Descartar chunks muy lejanos (liberar memoria)
-        m_world->unloadChunksFarFrom(currentChunkPos, UNLOAD_DISTANCE);
+    const float zoom = m_camera->getZoom();
+
+    // OPTIMIZACIÓN: Prefetch predictivo. En cada cambio de chunk mientras la
+    // cámara se mueve se pide, con alta prioridad, la región de carga donde
+    // estará dentro de ChunkPrefetcher::LOOKAHEAD_SECONDS
+    if (m_config.prefetch && currentChunkPos != m_lastPrefetchChunkPos && m_prefetcher.isMoving()) {
+        m_prefetcher.getPredictedChunks(*m_camera, m_viewportWidth, m_viewportHeight, LOAD_MARGIN,
+                                        MAX_RENDER_RADIUS + LOAD_MARGIN, m_prefetchChunkPositions);
+        m_world->prefetchChunks(m_prefetchChunkPositions);
+        m_lastPrefetchChunkPos = currentChunkPos;
+    }
+
+    if (totalMovement >= MOVEMENT_THRESHOLD || zoom != m_lastLoadZoom || m_viewportDirty) {
+        // Conjunto de carga: diamante visible + anillo de prefetch
+        m_camera->getVisibleChunks(m_viewportWidth, m_viewportHeight, LOAD_MARGIN,
+                                   MAX_RENDER_RADIUS + LOAD_MARGIN, m_loadChunkPositions);
+
+        // La zona protegida crece con la vista (zoom alejado) para no
+        // descargar chunks que siguen en pantalla
+        int viewRadius = 0;
+        for (const ChunkPos& pos : m_loadChunkPositions) {
+            viewRadius = std::max(viewRadius, std::max(abs(pos.x - currentChunkPos.x),
+                                                       abs(pos.z - currentChunkPos.z)));
+        }
+        ChunkPos keepCenter = currentChunkPos;
+        int keepDistance = viewRadius + UNLOAD_MARGIN;
+
+        // En movimiento la zona protegida se desplaza hacia adelante: cubre
+        // la región prevista y deja expuesto antes lo que queda detrás (la
+        // carga actual siempre queda dentro, a PREFETCH_UNLOAD_MARGIN o más del borde)
+        const ChunkPos ahead = m_config.prefetch ? m_prefetcher.getLookaheadChunks() : ChunkPos(0, 0);
+        if (ahead.x != 0 || ahead.z != 0) {
+            const int halfReach = (std::max(abs(ahead.x), abs(ahead.z)) + 1) / 2;
+            keepCenter = ChunkPos(currentChunkPos.x + ahead.x / 2, currentChunkPos.z + ahead.z / 2);
+            keepDistance = viewRadius + PREFETCH_UNLOAD_MARGIN + halfReach;
+        }
+
+        // Paso 1: Comprimir los chunks sin usar fuera de la zona protegida y,
+        // si aun así se supera el presupuesto de memoria, descartar los
+        // menos usados y más lejanos
+        m_world->compressIdleChunks(keepCenter, keepDistance, COLD_COMPRESS_BUDGET_MS);
+        m_world->evictChunks(keepCenter, keepDistance);
+        m_world->unloadImpostorsFarFrom(currentChunkPos, HORIZON_RADIUS + UNLOAD_MARGIN);
 
         // Paso 2: Cargar nuevos chunks necesarios (genera si no existen)
-        m_world->getChunksAround(currentChunkPos, LOAD_RADIUS);
+        m_world->getChunks(m_loadChunkPositions);
 
         // Paso 3: Actualizar última posición de la cámara
         m_lastChunkPos = currentChunkPos;
+        m_lastLoadZoom = zoom;
+        m_viewportDirty = false;
     }
 }
 
-void Game::render() {
+void Game::render(float alpha) {
+    TRACE_SCOPE("render");
+
+    // Cámara y jugador en el estado interpolado (el render puede ir a más o
+    // menos FPS que la simulación sin saltos visibles)
+    float playerX, playerY, playerZ;
+    applyRenderState(alpha, playerX, playerY, playerZ);
+
     // Limpiar pantalla
     m_renderer->clear();
 
-    // Obtener posición actual de la cámara
+    // OPTIMIZACIÓN: Conjunto visible derivado del frustum (diamante isométrico)
+    // en lugar de un cuadrado fijo de RENDER_RADIUS alrededor de la cámara.
+    // Solo se recalcula al cambiar la cámara de chunk, el zoom o la ventana:
+    // el chunk extra de margen cubre cualquier posición dentro del chunk actual
     float camX, camY, camZ;
     m_camera->getPosition(camX, camY, camZ);
-
-    // OPTIMIZACIÓN FASE 4: Usar cache para evitar std::floor repetidos
     ChunkPos camChunkPos = getCameraChunkPos(camX, camY, camZ);
+    const float zoom = m_camera->getZoom();
+
+    if (m_visibleRegionDirty || camChunkPos != m_visibleRegionCenter || zoom != m_visibleRegionZoom) {
+        m_camera->getVisibleChunks(m_viewportWidth, m_viewportHeight, 1, HORIZON_RADIUS,
+                                   m_visibleChunkPositions);
+
+        // Separar chunks completos (dentro de MAX_RENDER_RADIUS) de impostores de horizonte
+        m_impostorPositions.clear();
+        size_t nearCount = 0;
+        for (const ChunkPos& pos : m_visibleChunkPositions) {
+            if (abs(pos.x - camChunkPos.x) <= MAX_RENDER_RADIUS &&
+                abs(pos.z - camChunkPos.z) <= MAX_RENDER_RADIUS) {
+                m_visibleChunkPositions[nearCount++] = pos;
+            } else {
+                m_impostorPositions.push_back(pos);
+            }
+        }
+        m_visibleChunkPositions.resize(nearCount);
 
-    // OPTIMIZACIÓN FASE 1: Usar move semantics para evitar allocation adicional
-    m_visibleChunksCache = std::move(m_world->getChunksAround(camChunkPos, RENDER_RADIUS));
-
-    // Obtener posición del jugador ANTES de renderizar (para depth sorting correcto)
-    float playerX, playerY, playerZ;
-    m_player->getPosition(playerX, playerY, playerZ);
-
-    // Renderizar mundo con el jugador integrado en el depth sorting
-    m_renderer->renderWorld(m_visibleChunksCache, *m_camera, playerX, playerY, playerZ);
+        m_world->setVisibleRegion(m_visibleChunkPositions);
+        m_visibleRegionCenter = camChunkPos;
+        m_visibleRegionZoom = zoom;
+        m_visibleRegionDirty = false;
+    }
 
-    // NOTA: El jugador ya se renderiza dentro de renderWorld() con depth correcto
-    // Ya no necesitamos llamar a renderPlayer() por separado
-    // m_renderer->renderPlayer(*m_camera, playerX, playerY, playerZ, m_player->getTileName());
+    // Frame habitual: sin lock, sin hashing y sin allocations
+    PROFILE_BEGIN(GET_CHUNKS);
+    m_world->updateVisibleSet();
+    const std::vector<Chunk*>& visibleChunks = m_world->getVisibleChunks();
+    m_world->getImpostors(m_impostorPositions, m_visibleImpostorsCache);
+    PROFILE_END(GET_CHUNKS);
+
+    // Enviar el jugador a la capa de sprites dinámicos (se intercala con el
+    // terreno en su profundidad dentro de renderWorld)
+    m_renderer->submitSprite(m_playerSprite, playerX, playerY, playerZ);
+
+    // Renderizar mundo + sprites dinámicos
+    m_renderer->renderWorld(visibleChunks, m_visibleImpostorsCache, *m_camera);
+
+    // Panel de depuración en esquina superior izquierda (1 draw call con el atlas de glifos)
+    char limitText[48];
+    if (m_framePacer.getTargetFps() > 0) {
+        std::snprintf(limitText, sizeof(limitText), "%d FPS (MISSED %llu)", m_framePacer.getTargetFps(),
+                      static_cast<unsigned long long>(m_framePacer.getMissedDeadlines()));
+    } else {
+        std::snprintf(limitText, sizeof(limitText), "OFF");
+    }
 
-    // Dibujar FPS en esquina superior izquierda
-    m_renderer->drawFPS(m_currentFPS);
+    char debugText[320];
+    std::snprintf(debugText, sizeof(debugText),
+                  "FPS: %d\nFRAME: %.2f MS\nLIMIT: %s\nTICK: %d HZ (%d/FRAME)\nCHUNKS: %zu (VIS %zu, COLD %zu) %.1f/%d MB\nIMPOSTORS: %zu (VIS %zu)\nTILES: %zu",
+                  m_currentFPS, m_averageFrameMs, limitText, m_config.tickRate, m_lastTickCount,
+                  m_world->getChunkCount(), visibleChunks.size(), m_world->getColdChunkCount(),
+                  m_world->getResidentBytes() / (1024.0 * 1024.0), m_config.chunkBudgetMB,
+                  m_world->getImpostorCount(), m_visibleImpostorsCache.size(),
+                  m_renderer->getLastTileCount());
+    m_renderer->drawDebugText(debugText, 20, 20);
+
+#ifdef ENABLE_PROFILER
+    // Gráfico apilado de tiempos por etapa (F3) debajo del panel de depuración
+    if (m_showProfiler) {
+        m_renderer->drawProfiler(Profiler::instance(), 20, 170);
+    }
+#endif
 
     // Presentar renderizado
     m_renderer->present();
@@ -0,0 +1,226 @@
+/**
+ * @file InputLog.cpp
+ * @brief Implementación de la grabación y reproducción del input
+ */
+
+#include "core/InputLog.hpp"
+#include <cstring>
+
+namespace {
+
+constexpr char MAGIC[4] = {'I', 'G', 'I', 'L'};
+constexpr uint16_t VERSION = 2;  ///< 2: cabecera con ticks por segundo
+
+// Serialización little-endian explícita (independiente de la plataforma)
+void putU8(std::vector<uint8_t>& out, uint8_t value) {
+    out.push_back(value);
+}
+
+void putU16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+void putF32(std::vector<uint8_t>& out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    putU32(out, bits);
+}
+
+bool readBytes(std::ifstream& in, uint8_t* data, size_t size) {
+    in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<size_t>(in.gcount()) == size;
+}
+
+bool getU8(std::ifstream& in, uint8_t& value) {
+    return readBytes(in, &value, 1);
+}
+
+bool getU16(std::ifstream& in, uint16_t& value) {
+    uint8_t b[2];
+    if (!readBytes(in, b, 2)) return false;
+    value = static_cast<uint16_t>(b[0] | (b[1] << 8));
+    return true;
+}
+
+bool getU32(std::ifstream& in, uint32_t& value) {
+    uint8_t b[4];
+    if (!readBytes(in, b, 4)) return false;
+    value = static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8) |
+            (static_cast<uint32_t>(b[2]) << 16) | (static_cast<uint32_t>(b[3]) << 24);
+    return true;
+}
+
+bool getF32(std::ifstream& in, float& value) {
+    uint32_t bits;
+    if (!getU32(in, bits)) return false;
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+} // namespace
+
+// ============================================================================
+// InputRecorder
+// ============================================================================
+
+bool InputRecorder::open(const std::string& path, uint32_t seed, int width, int height, int tickRate) {
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    m_bytes.clear();
+    m_bytes.insert(m_bytes.end(), MAGIC, MAGIC + 4);
+    putU16(m_bytes, VERSION);
+    putU32(m_bytes, seed);
+    putU32(m_bytes, static_cast<uint32_t>(width));
+    putU32(m_bytes, static_cast<uint32_t>(height));
+    putU16(m_bytes, static_cast<uint16_t>(tickRate));
+    m_file.write(reinterpret_cast<const char*>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+
+    m_frameCount = 0;
+    m_frameOpen = false;
+    return true;
+}
+
+void InputRecorder::beginFrame(float deltaTime) {
+    if (m_frameOpen) {
+        endFrame();
+    }
+    m_frameDelta = deltaTime;
+    m_frameEvents.clear();
+    m_frameOpen = true;
+}
+
+void InputRecorder::record(const InputEvent& event) {
+    if (m_frameOpen) {
+        m_frameEvents.push_back(event);
+    }
+}
+
+bool InputRecorder::endFrame() {
+    if (!m_frameOpen || !m_file.is_open()) {
+        return true;
+    }
+
+    if (m_frameEvents.size() > MAX_FRAME_EVENTS) {
+        m_frameOpen = false;
+        m_file.close();
+        return false;
+    }
+
+    m_bytes.clear();
+    putF32(m_bytes, m_frameDelta);
+    putU16(m_bytes, static_cast<uint16_t>(m_frameEvents.size()));
+
+    for (const InputEvent& event : m_frameEvents) {
+        putU8(m_bytes, static_cast<uint8_t>(event.type));
+        switch (event.type) {
+            case InputEventType::KEY_DOWN:
+            case InputEventType::KEY_UP:
+                putU32(m_bytes, static_cast<uint32_t>(event.a));
+                break;
+            case InputEventType::RESIZE:
+                putU32(m_bytes, static_cast<uint32_t>(event.a));
+                putU32(m_bytes, static_cast<uint32_t>(event.b));
+                break;
+            case InputEventType::QUIT:
+                break;
+        }
+    }
+
+    m_file.write(reinterpret_cast<const char*>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+    m_frameOpen = false;
+    m_frameCount++;
+    return true;
+}
+
+void InputRecorder::close() {
+    endFrame();
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+}
+
+// ============================================================================
+// InputReplayer
+// ============================================================================
+
+bool InputReplayer::open(const std::string& path) {
+    m_file.open(path, std::ios::binary);
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    char magic[4];
+    uint16_t version = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    if (!readBytes(m_file, reinterpret_cast<uint8_t*>(magic), 4) ||
+        std::memcmp(magic, MAGIC, 4) != 0 ||
+        !getU16(m_file, version) || version < 1 || version > VERSION ||
+        !getU32(m_file, m_seed) || !getU32(m_file, width) || !getU32(m_file, height)) {
+        m_file.close();
+        return false;
+    }
+
+    uint16_t tickRate = 0;
+    if (version >= 2 && !getU16(m_file, tickRate)) {
+        m_file.close();
+        return false;
+    }
+    m_tickRate = tickRate;
+
+    m_width = static_cast<int>(width);
+    m_height = static_cast<int>(height);
+    m_frameCount = 0;
+    return true;
+}
+
+bool InputReplayer::nextFrame(float& deltaTime, std::vector<InputEvent>& events) {
+    events.clear();
+
+    uint16_t eventCount = 0;
+    if (!m_file.is_open() || !getF32(m_file, deltaTime) || !getU16(m_file, eventCount)) {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < eventCount; i++) {
+        InputEvent event;
+        uint8_t type = 0;
+        uint32_t a = 0;
+        uint32_t b = 0;
+        if (!getU8(m_file, type)) {
+            return false;
+        }
+
+        event.type = static_cast<InputEventType>(type);
+        switch (event.type) {
+            case InputEventType::KEY_DOWN:
+            case InputEventType::KEY_UP:
+                if (!getU32(m_file, a)) return false;
+                break;
+            case InputEventType::RESIZE:
+                if (!getU32(m_file, a) || !getU32(m_file, b)) return false;
+                break;
+            case InputEventType::QUIT:
+                break;
+            default:
+                return false;  // Log corrupto
+        }
+
+        event.a = static_cast<int32_t>(a);
+        event.b = static_cast<int32_t>(b);
+        events.push_back(event);
+    }
+
+    m_frameCount++;
+    return true;
+}
@@ -156,16 +156,9 @@ void Player::spawnOnSurface(World* world) {
     if (localX < 0) localX += BlockConfig::CHUNK_SIZE;
     if (localZ < 0) localZ += BlockConfig::CHUNK_SIZE;
 
-    // Buscar desde arriba hacia abajo el primer bloque sólido
-    // WORLD_HEIGHT es 256, así que buscamos desde Y=255 hasta Y=0
-    int surfaceY = BlockConfig::WORLD_HEIGHT - 1;
-    for (int y = BlockConfig::WORLD_HEIGHT - 1; y >= 0; y--) {
-        const Block& block = chunk->getBlock(localX, y, localZ);
-        if (block.esSolido()) {
-            surfaceY = y;
-            break; // Encontramos el primer bloque sólido desde arriba
-        }
-    }
+    // OPTIMIZACIÓN: La altura sale del heightmap del chunk (bloque sólido
+    // más alto, árboles incluidos) en lugar de recorrer la columna desde arriba
+    int surfaceY = chunk->getMaxY(localX, localZ);
 
     // Posicionar al jugador en la superficie + 1
     // +1 para que el jugador esté ENCIMA del bloque, no dentro de él
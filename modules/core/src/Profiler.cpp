@@ -0,0 +1,88 @@
+/**
+ * @file Profiler.cpp
+ * @brief Implementación del profiler por etapas del frame
+ */
+
+#include "core/Profiler.hpp"
+#include <algorithm>
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::beginFrame() {
+    const Clock::time_point now = Clock::now();
+
+    if (m_frameOpen) {
+        m_current.totalMs = std::chrono::duration<float, std::milli>(now - m_frameStart).count();
+        m_history[m_head] = m_current;
+        m_head = (m_head + 1) % HISTORY_SIZE;
+        if (m_count < HISTORY_SIZE) {
+            m_count++;
+        }
+    }
+
+    m_current = ProfileFrame{};
+    m_frameStart = now;
+    m_frameOpen = true;
+}
+
+void Profiler::getFrameTimePercentiles(float& p50, float& p95, float& p99) const {
+    if (m_count == 0) {
+        p50 = p95 = p99 = 0.0f;
+        return;
+    }
+
+    // Copia local: el historial es pequeño (HISTORY_SIZE floats en el stack)
+    std::array<float, HISTORY_SIZE> totals;
+    for (size_t i = 0; i < m_count; i++) {
+        totals[i] = getFrame(i).totalMs;
+    }
+    std::sort(totals.begin(), totals.begin() + m_count);
+
+    auto percentile = [&](float p) {
+        size_t index = static_cast<size_t>(p * (m_count - 1) + 0.5f);
+        return totals[std::min(index, m_count - 1)];
+    };
+
+    p50 = percentile(0.50f);
+    p95 = percentile(0.95f);
+    p99 = percentile(0.99f);
+}
+
+float Profiler::getStageAverage(ProfileStage stage) const {
+    if (m_count == 0) {
+        return 0.0f;
+    }
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < m_count; i++) {
+        sum += getFrame(i).stageMs[static_cast<size_t>(stage)];
+    }
+    return sum / m_count;
+}
+
+const char* Profiler::getStageName(ProfileStage stage) {
+    switch (stage) {
+        case ProfileStage::INPUT:         return "INPUT";
+        case ProfileStage::PLAYER_UPDATE: return "PLAYER";
+        case ProfileStage::UPDATE_CHUNKS: return "UPDATE CHUNKS";
+        case ProfileStage::GET_CHUNKS:    return "GET CHUNKS";
+        case ProfileStage::BUILD_LIST:    return "BUILD LIST";
+        case ProfileStage::SORT:          return "SORT";
+        case ProfileStage::SUBMIT:        return "SUBMIT";
+        case ProfileStage::PRESENT:       return "PRESENT";
+        default:                          return "?";
+    }
+}
+
+const char* Profiler::getCounterName(ProfileCounter counter) {
+    switch (counter) {
+        case ProfileCounter::SOLID_BLOCKS:  return "SOLID";
+        case ProfileCounter::CULLED_BLOCKS: return "CULLED";
+        case ProfileCounter::ADDED_BLOCKS:  return "ADDED";
+        case ProfileCounter::CHUNKS_DRAWN:  return "CHUNKS DRAWN";
+        default:                            return "?";
+    }
+}
@@ -0,0 +1,253 @@
+/**
+ * @file Trace.cpp
+ * @brief Buffers de trazas por thread y exportación a Chrome trace JSON
+ */
+
+#include "core/Trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Trace {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum class EventType : uint8_t {
+    SLICE,
+    COUNTER,
+    INSTANT,
+    FLOW_BEGIN,
+    FLOW_END
+};
+
+/**
+ * @brief Slot del buffer circular
+ *
+ * Campos atómicos con acceso relaxed: el volcado puede leer un slot mientras
+ * el thread dueño lo sobrescribe. En x86 son loads/stores normales.
+ */
+struct EventSlot {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> timestamp{0};
+    std::atomic<uint64_t> duration{0};
+    std::atomic<int64_t> value{0};     ///< Valor del contador o id del flujo
+    std::atomic<EventType> type{EventType::SLICE};
+};
+
+/**
+ * @brief Copia no atómica de un evento (usada al volcar)
+ */
+struct Event {
+    const char* name;
+    uint64_t timestamp;
+    uint64_t duration;
+    int64_t value;
+    EventType type;
+};
+
+/**
+ * @brief Buffer circular de un thread (un solo escritor)
+ */
+struct ThreadBuffer {
+    std::unique_ptr<EventSlot[]> slots{new EventSlot[BUFFER_CAPACITY]};
+    std::atomic<uint64_t> head{0};               ///< Eventos publicados (total histórico)
+    std::atomic<const char*> threadName{nullptr};
+    uint32_t tid = 0;
+};
+
+/**
+ * @brief Registro global de buffers
+ *
+ * El mutex solo se toma al crear el buffer de un thread y al volcar.
+ * Los buffers nunca se liberan: un thread terminado conserva su traza.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    Clock::time_point epoch = Clock::now();
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer& threadBuffer() {
+    if (!t_buffer) {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.push_back(std::make_unique<ThreadBuffer>());
+        t_buffer = reg.buffers.back().get();
+        t_buffer->tid = static_cast<uint32_t>(reg.buffers.size());
+    }
+    return *t_buffer;
+}
+
+void record(EventType type, const char* name, uint64_t timestamp, uint64_t duration, int64_t value) {
+    ThreadBuffer& buffer = threadBuffer();
+    const uint64_t index = buffer.head.load(std::memory_order_relaxed);
+    EventSlot& slot = buffer.slots[index & (BUFFER_CAPACITY - 1)];
+
+    // Ordena la publicación anterior antes de sobrescribir el slot: si el
+    // volcado lee algún campo nuevo, también verá el head que lo invalida
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.timestamp.store(timestamp, std::memory_order_relaxed);
+    slot.duration.store(duration, std::memory_order_relaxed);
+    slot.value.store(value, std::memory_order_relaxed);
+    slot.type.store(type, std::memory_order_relaxed);
+
+    buffer.head.store(index + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Copia los eventos válidos de un buffer mientras su thread sigue escribiendo
+ */
+void snapshot(const ThreadBuffer& buffer, std::vector<Event>& out) {
+    out.clear();
+
+    const uint64_t end = buffer.head.load(std::memory_order_acquire);
+    const uint64_t begin = (end > BUFFER_CAPACITY) ? end - BUFFER_CAPACITY : 0;
+    out.reserve(static_cast<size_t>(end - begin));
+
+    for (uint64_t i = begin; i < end; i++) {
+        const EventSlot& slot = buffer.slots[i & (BUFFER_CAPACITY - 1)];
+        out.push_back({slot.name.load(std::memory_order_relaxed),
+                       slot.timestamp.load(std::memory_order_relaxed),
+                       slot.duration.load(std::memory_order_relaxed),
+                       slot.value.load(std::memory_order_relaxed),
+                       slot.type.load(std::memory_order_relaxed)});
+    }
+
+    // Descartar los slots que el escritor pudo sobrescribir durante la copia.
+    // El evento en curso (índice head) reutiliza el slot de head - CAPACITY.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t headAfter = buffer.head.load(std::memory_order_relaxed);
+    const uint64_t firstValid = (headAfter >= BUFFER_CAPACITY) ? headAfter - BUFFER_CAPACITY + 1 : 0;
+    if (firstValid > begin) {
+        const size_t discard = static_cast<size_t>(std::min<uint64_t>(firstValid - begin, out.size()));
+        out.erase(out.begin(), out.begin() + discard);
+    }
+}
+
+/**
+ * @brief Escribe un string JSON escapado (los nombres son literales, casi nunca hace falta)
+ */
+void writeJsonString(std::FILE* file, const char* text) {
+    std::fputc('"', file);
+    for (const char* c = text ? text : "?"; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(*c, file);
+    }
+    std::fputc('"', file);
+}
+
+} // namespace
+
+uint64_t now() {
+    const auto elapsed = Clock::now() - registry().epoch;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void setThreadName(const char* name) {
+    threadBuffer().threadName.store(name, std::memory_order_relaxed);
+}
+
+void recordSlice(const char* name, uint64_t startNs, uint64_t endNs) {
+    record(EventType::SLICE, name, startNs, endNs - startNs, 0);
+}
+
+void recordCounter(const char* name, int64_t value) {
+    record(EventType::COUNTER, name, now(), 0, value);
+}
+
+void recordInstant(const char* name) {
+    record(EventType::INSTANT, name, now(), 0, 0);
+}
+
+void recordFlowBegin(const char* name, uint64_t id) {
+    record(EventType::FLOW_BEGIN, name, now(), 0, static_cast<int64_t>(id));
+}
+
+void recordFlowEnd(const char* name, uint64_t id) {
+    record(EventType::FLOW_END, name, now(), 0, static_cast<int64_t>(id));
+}
+
+bool dump(const char* path) {
+    std::FILE* file = std::fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    bool first = true;
+    std::vector<Event> events;
+
+    for (const auto& buffer : reg.buffers) {
+        const uint32_t tid = buffer->tid;
+
+        // Metadata: nombre del thread
+        const char* threadName = buffer->threadName.load(std::memory_order_relaxed);
+        if (threadName) {
+            std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                         first ? "" : ",\n", tid);
+            writeJsonString(file, threadName);
+            std::fputs("}}", file);
+            first = false;
+        }
+
+        snapshot(*buffer, events);
+
+        for (const Event& event : events) {
+            std::fputs(first ? "{\"name\":" : ",\n{\"name\":", file);
+            first = false;
+            writeJsonString(file, event.name);
+
+            // Timestamps en microsegundos (formato de Chrome trace)
+            const double ts = event.timestamp / 1000.0;
+
+            switch (event.type) {
+                case EventType::SLICE:
+                    std::fprintf(file, ",\"cat\":\"game\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                                 ts, event.duration / 1000.0, tid);
+                    break;
+                case EventType::COUNTER:
+                    std::fprintf(file, ",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"value\":%lld}}",
+                                 ts, tid, static_cast<long long>(event.value));
+                    break;
+                case EventType::INSTANT:
+                    std::fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", ts, tid);
+                    break;
+                case EventType::FLOW_BEGIN:
+                    std::fprintf(file, ",\"cat\":\"flow\",\"ph\":\"s\",\"id\":%llu,\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                                 static_cast<unsigned long long>(event.value), ts, tid);
+                    break;
+                case EventType::FLOW_END:
+                    std::fprintf(file, ",\"cat\":\"flow\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%llu,\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                                 static_cast<unsigned long long>(event.value), ts, tid);
+                    break;
+            }
+        }
+    }
+
+    std::fputs("\n]}\n", file);
+    const bool ok = (std::ferror(file) == 0);
+    std::fclose(file);
+    return ok;
+}
+
+} // namespace Trace
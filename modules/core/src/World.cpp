@@ -8,10 +8,70 @@
 
 #define FNL_IMPL
 #include "core/World.hpp"
+#include "core/Trace.hpp"
+#include "core/ChunkCodec.hpp"
+#include "utils/JobSystem.hpp"
+#include "utils/FrameArena.hpp"
 #include <iostream>
 #include <cmath>
 #include <algorithm>  // Para std::clamp, std::max
 #include <vector>     // Para std::vector
+#include <limits>
+
+namespace {
+
+/**
+ * @brief Id de flujo de traza para un chunk (une la solicitud con su generación)
+ */
+[[maybe_unused]] uint64_t chunkTraceId(ChunkPos pos) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(pos.x)) << 32) | static_cast<uint32_t>(pos.z);
+}
+
+/**
+ * @brief Hash determinista de una columna del mundo
+ * @param seed Semilla del mundo
+ * @param worldX, worldZ Coordenadas mundiales de la columna
+ *
+ * Solo depende de la semilla y la posición: el resultado no cambia con el
+ * orden en que se generan los chunks (a diferencia de un generador con estado).
+ */
+uint32_t columnHash(uint32_t seed, int worldX, int worldZ) {
+    uint32_t h = seed;
+    h ^= static_cast<uint32_t>(worldX) * 0x9E3779B1u;
+    h ^= static_cast<uint32_t>(worldZ) * 0x85EBCA77u;
+    // Finalizador de MurmurHash3 (avalancha completa)
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * @brief Desplazamiento a un chunk vecino y los lados que lo enlazan
+ */
+struct ChunkNeighborOffset {
+    int dx, dz;
+    ChunkSide side;      ///< Lado del chunk central donde está el vecino
+    ChunkSide opposite;  ///< Lado del vecino donde está el chunk central
+};
+
+constexpr ChunkNeighborOffset NEIGHBOR_OFFSETS[4] = {
+    { 1,  0, ChunkSide::EAST,  ChunkSide::WEST },
+    {-1,  0, ChunkSide::WEST,  ChunkSide::EAST },
+    { 0,  1, ChunkSide::SOUTH, ChunkSide::NORTH},
+    { 0, -1, ChunkSide::NORTH, ChunkSide::SOUTH},
+};
+
+/**
+ * @brief Orden total de ChunkPos (x, luego z) para búsqueda binaria
+ */
+bool chunkPosLess(const ChunkPos& a, const ChunkPos& b) {
+    return (a.x != b.x) ? (a.x < b.x) : (a.z < b.z);
+}
+
+} // namespace
 
 /**
  * @brief Constructor del mundo
@@ -23,7 +83,6 @@
  */
 World::World(uint32_t seed)
     : m_seed(seed)
-    , m_rng(seed)
     , m_biomeCacheInitialized(true)  // Cache se inicializa ahora en constructor
     , m_chunkGeneratorShouldStop(false)  // Inicializar flag de thread
 {
@@ -51,23 +110,22 @@ World::World(uint32_t seed)
     // Pre-asignar espacio para chunks típicos (LOAD_RADIUS=5 -> ~121 chunks)
     m_chunks.reserve(150);
 
-    // OPTIMIZACIÓN 6: Iniciar thread de background para generación de chunks
-    m_chunkGeneratorThread = std::thread(&World::chunkGenerationWorker, this);
+    // OPTIMIZACIÓN 6: La generación de chunks usa el JobSystem compartido.
+    // Crearlo aquí garantiza que su thread principal sea el del juego.
+    JobSystem::instance();
 }
 
 /**
- * @brief Destructor - detiene el thread de background
+ * @brief Destructor - espera a los jobs de generación pendientes
  *
- * Espera a que el thread de generación termine antes de destruir el mundo.
+ * Los jobs que todavía no empezaron terminan de inmediato al ver la señal
+ * de parada; los que están generando terminan su chunk.
  */
 World::~World() {
-    // Señalar al thread que debe detenerse
     m_chunkGeneratorShouldStop = true;
-    m_chunkQueueCV.notify_one();
 
-    // Esperar a que el thread termine
-    if (m_chunkGeneratorThread.joinable()) {
-        m_chunkGeneratorThread.join();
+    while (m_generationJobsInFlight.load(std::memory_order_acquire) > 0) {
+        std::this_thread::yield();
     }
 }
 
@@ -176,7 +234,203 @@ void World::setBlock(int x, int y, int z, BlockType type) {
 
     int localX, localZ;
     BlockUtils::worldToLocal(x, z, localX, localZ);
-    chunk->setBlock(localX, y, localZ, type);
+
+    if (y < 0 || y >= BlockConfig::WORLD_HEIGHT) {
+        return;
+    }
+
+    // Un bloque sólido nuevo puede hacer crecer los arrays densos
+    const size_t bytesBefore = chunk->getResidentBytes();
+    chunk->setBlock(localX, y, localZ, type, RenderVariants::fromPosition(type, x, z));
+    m_residentBytes += chunk->getResidentBytes() - bytesBefore;
+
+    // Heightmap, superficie (LOD lejano) y bounds de culling al día
+    chunk->refreshColumn(localX, localZ);
+    chunk->updateHeightBounds();
+    auto impostorIt = m_impostors.find(chunkPos);
+    if (impostorIt != m_impostors.end()) {
+        copySurfaceToImpostor(*chunk, impostorIt->second);
+    }
+
+    // Registrar el delta (el último cambio de cada bloque reemplaza al anterior)
+    std::vector<WorldSave::BlockDelta>& deltas = m_blockDeltas[chunkPos];
+    const uint16_t index = WorldSave::packLocal(localX, y, localZ);
+    auto it = std::find_if(deltas.begin(), deltas.end(),
+                           [index](const WorldSave::BlockDelta& delta) { return delta.index == index; });
+    if (it != deltas.end()) {
+        it->type = type;
+    } else {
+        deltas.push_back({index, type});
+    }
+}
+
+bool World::saveDeltas(const std::string& path, size_t* bytesWritten) const {
+    // Ordenados por posición: el mismo mundo produce siempre el mismo archivo
+    std::vector<WorldSave::ChunkDelta> chunks;
+    chunks.reserve(m_blockDeltas.size());
+    for (const auto& [pos, deltas] : m_blockDeltas) {
+        chunks.push_back({pos, deltas});
+    }
+    std::sort(chunks.begin(), chunks.end(),
+              [](const WorldSave::ChunkDelta& a, const WorldSave::ChunkDelta& b) { return chunkPosLess(a.pos, b.pos); });
+
+    return WorldSave::write(path, m_seed, chunks, bytesWritten);
+}
+
+bool World::loadDeltas(const std::string& path) {
+    uint32_t seed = 0;
+    std::vector<WorldSave::ChunkDelta> chunks;
+    if (!WorldSave::read(path, seed, chunks) || seed != m_seed) {
+        return false;
+    }
+
+    // Los chunks con deltas viejos o nuevos ya no coinciden con el guardado:
+    // descartarlos para que se regeneren (y reciban los deltas en publishChunk)
+    // Un job en vuelo (generación o expansión del tier frío) entregaría los
+    // bloques viejos: su resultado se descarta al llegar
+    auto discard = [this](ChunkPos pos) {
+        unloadChunk(pos);
+        auto coldIt = m_coldChunks.find(pos);
+        if (coldIt != m_coldChunks.end()) {
+            dropColdChunk(coldIt);
+        }
+        if (m_chunksInFlight.count(pos)) {
+            m_staleInFlight.insert(pos);
+        }
+    };
+    for (const auto& entry : m_blockDeltas) {
+        discard(entry.first);
+    }
+
+    m_blockDeltas.clear();
+    for (WorldSave::ChunkDelta& chunk : chunks) {
+        discard(chunk.pos);
+        m_blockDeltas[chunk.pos] = std::move(chunk.blocks);
+    }
+
+    m_visibleSetDirty = true;
+    return true;
+}
+
+bool World::saveSnapshot(const std::string& path, const WorldSnapshot::ViewState& view, size_t* bytesWritten) {
+    // Los chunks cargados se comprimen a un buffer común; los spans se arman
+    // al final (el buffer puede reubicarse mientras crece)
+    struct LoadedChunk {
+        ChunkPos pos;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<uint8_t> loadedData;
+    std::vector<LoadedChunk> loaded;
+    loaded.reserve(m_chunks.size());
+    for (const auto& [pos, chunk] : m_chunks) {
+        if (!ChunkCodec::compress(*chunk, m_compressBuffer)) {
+            continue;  // No cabe en el formato: se regenera al reanudar
+        }
+        loaded.push_back({pos, loadedData.size(), m_compressBuffer.size()});
+        loadedData.insert(loadedData.end(), m_compressBuffer.begin(), m_compressBuffer.end());
+    }
+
+    std::vector<WorldSnapshot::ChunkData> chunks;
+    chunks.reserve(loaded.size() + m_coldChunks.size());
+    for (const LoadedChunk& chunk : loaded) {
+        chunks.push_back({chunk.pos, std::span<const uint8_t>(loadedData.data() + chunk.offset, chunk.size)});
+    }
+    for (const auto& [pos, cold] : m_coldChunks) {
+        chunks.push_back({pos, cold.data});
+    }
+
+    std::vector<WorldSnapshot::DeltaRecord> deltas;
+    deltas.reserve(getDeltaBlockCount());
+    for (const auto& [pos, blockDeltas] : m_blockDeltas) {
+        for (const WorldSave::BlockDelta& delta : blockDeltas) {
+            deltas.push_back({pos.x, pos.z, delta.index, static_cast<uint8_t>(delta.type), 0});
+        }
+    }
+
+    return WorldSnapshot::write(path, m_seed, view, chunks, deltas, bytesWritten);
+}
+
+bool World::restoreSnapshot(const WorldSnapshot::MappedSnapshot& snapshot) {
+    if (snapshot.getSeed() != m_seed) {
+        return false;
+    }
+
+    m_coldChunks.reserve(m_coldChunks.size() + snapshot.getChunks().size());
+    for (const WorldSnapshot::ChunkEntry& entry : snapshot.getChunks()) {
+        const ChunkPos pos(entry.x, entry.z);
+        if (m_chunks.count(pos) || m_chunksInFlight.count(pos)) {
+            continue;
+        }
+
+        auto [it, inserted] = m_coldChunks.try_emplace(pos);
+        if (!inserted) {
+            continue;
+        }
+        const uint8_t* data = snapshot.getChunkData(entry);
+        it->second.data.assign(data, data + entry.size);  // Único copiado del chunk
+        it->second.lastUsed = m_useClock;
+
+        const size_t bytes = it->second.getResidentBytes();
+        m_coldBytes += bytes;
+        m_residentBytes += bytes;
+    }
+
+    for (const WorldSnapshot::DeltaRecord& record : snapshot.getDeltas()) {
+        if (record.index >= DenseBlockStorage::MAX_BLOCKS ||
+            record.type >= static_cast<uint8_t>(BlockType::TOTAL_TIPOS)) {
+            continue;
+        }
+        m_blockDeltas[ChunkPos(record.x, record.z)].push_back({record.index, static_cast<BlockType>(record.type)});
+    }
+
+    m_visibleSetDirty = true;
+    return true;
+}
+
+size_t World::getDeltaBlockCount() const {
+    size_t count = 0;
+    for (const auto& entry : m_blockDeltas) {
+        count += entry.second.size();
+    }
+    return count;
+}
+
+void World::applyBlockDeltas(Chunk& chunk, const std::vector<WorldSave::BlockDelta>& deltas) {
+    const int worldXStart = chunk.getPosition().x * BlockConfig::CHUNK_SIZE;
+    const int worldZStart = chunk.getPosition().z * BlockConfig::CHUNK_SIZE;
+
+    uint64_t touchedColumns = 0;  // Bit x + z*8
+    for (const WorldSave::BlockDelta& delta : deltas) {
+        int x, y, z;
+        WorldSave::unpackLocal(delta.index, x, y, z);
+        chunk.setBlock(x, y, z, delta.type,
+                       RenderVariants::fromPosition(delta.type, worldXStart + x, worldZStart + z));
+        touchedColumns |= uint64_t(1) << (x + z * BlockConfig::CHUNK_SIZE);
+    }
+
+    for (int column = 0; column < BlockConfig::CHUNK_SIZE * BlockConfig::CHUNK_SIZE; column++) {
+        if (touchedColumns & (uint64_t(1) << column)) {
+            chunk.refreshColumn(column % BlockConfig::CHUNK_SIZE, column / BlockConfig::CHUNK_SIZE);
+        }
+    }
+    chunk.updateHeightBounds();
+}
+
+void World::copySurfaceToImpostor(const Chunk& chunk, ImpostorChunk& impostor) {
+    impostor.surface = chunk.getSurfaceColumns();
+
+    int minHeight = BlockConfig::WORLD_HEIGHT;
+    int maxHeight = 0;
+    for (SurfaceColumn& surface : impostor.surface) {
+        // Los impostores no llevan árboles (como los generados con ruido)
+        surface.topType = BlockType::AIRE;
+        surface.topVariant = 0;
+        minHeight = std::min(minHeight, static_cast<int>(surface.groundY));
+        maxHeight = std::max(maxHeight, static_cast<int>(surface.groundY));
+    }
+    impostor.minHeight = minHeight;
+    impostor.maxHeight = maxHeight;
 }
 
 /**
@@ -191,76 +445,99 @@ void World::setBlock(int x, int y, int z, BlockType type) {
  */
 
 /**
- * @brief Worker thread para generación asíncrona de chunks
+ * @brief Job de generación asíncrona de un chunk
  *
- * Este método corre en un thread separado y genera chunks en background.
- * Procesa la cola de chunks pendientes de generación.
+ * Se ejecuta en un worker del JobSystem compartido. Varios chunks se generan
+ * en paralelo: generateTerrain solo lee estado inmutable (ruido, cache de
+ * biomas) y el pool se accede bajo m_chunkPoolMutex.
+ *
+ * El chunk terminado NO se inserta en m_chunks: se entrega por la cola de
+ * completados y lo publica el thread principal (processCompletedChunks).
  *
  * OPTIMIZACIÓN 6: Multithreaded Chunk Generation
  * - Evita bloquear el main thread durante generación de terreno
- * - Mejora la fluidez del juego al explorar nuevo territorio
- * - Usa condition_variable para esperar sin consumir CPU
+ * - Reparte los chunks pendientes entre todos los workers
  */
-void World::chunkGenerationWorker() {
-    while (true) {
-        ChunkPos posToGenerate;
-
-        // Esperar a que haya trabajo o señal de parada
-        {
-            std::unique_lock<std::mutex> lock(m_chunkQueueMutex);
-
-            // Esperar hasta que haya chunks en la cola o debamos detenernos
-            m_chunkQueueCV.wait(lock, [this] {
-                return !m_chunkGenerationQueue.empty() || m_chunkGeneratorShouldStop;
-            });
-
-            // Verificar si debemos detenernos
-            if (m_chunkGeneratorShouldStop && m_chunkGenerationQueue.empty()) {
-                break;  // Salir del loop
-            }
+void World::generateChunkJob(ChunkPos pos) {
+    TRACE_THREAD_NAME("job worker");
 
-            // Si hay chunks en la cola, tomar el siguiente
-            if (!m_chunkGenerationQueue.empty()) {
-                posToGenerate = m_chunkGenerationQueue.front();
-                m_chunkGenerationQueue.pop();
-            } else if (m_chunkGeneratorShouldStop) {
-                break;  // Señal de parada sin chunks pendientes
-            } else {
-                continue;  // Spurious wakeup, volver a esperar
-            }
+    if (!m_chunkGeneratorShouldStop.load(std::memory_order_acquire)) {
+        TRACE_SCOPE("generateChunk");
+        TRACE_FLOW_END("chunk request", chunkTraceId(pos));
+        std::unique_ptr<Chunk> chunk = acquireChunk(pos);
+
+        // Generar terreno sin ningún lock
+        auto generationStart = std::chrono::steady_clock::now();
+        generateTerrain(chunk.get());
+        recordGeneration(std::chrono::steady_clock::now() - generationStart);
+        chunk->setGenerated(true);
+
+        // OPTIMIZACIÓN: Entrega lock-free al thread principal
+        m_completedChunks.push(std::move(chunk));
+    }
+
+    // Último acceso al World: el destructor espera a que este contador llegue a 0
+    m_generationJobsInFlight.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+ * @brief Job de expansión de un chunk del tier frío
+ *
+ * Decodificar paleta + RLE cuesta una fracción de generateTerrain (sin
+ * ruido 2D/3D): el chunk vuelve a estar disponible en el frame siguiente.
+ */
+void World::thawChunkJob(ChunkPos pos, const std::vector<uint8_t>& data) {
+    TRACE_THREAD_NAME("job worker");
+
+    if (!m_chunkGeneratorShouldStop.load(std::memory_order_acquire)) {
+        TRACE_SCOPE("thawChunk");
+        TRACE_FLOW_END("chunk request", chunkTraceId(pos));
+        std::unique_ptr<Chunk> chunk = acquireChunk(pos);
+
+        if (ChunkCodec::decompress(data.data(), data.size(), *chunk)) {
+            m_chunksThawed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            // Datos ilegibles: regenerar (el resultado es el mismo que la primera vez)
+            chunk->clear();
+            auto generationStart = std::chrono::steady_clock::now();
+            generateTerrain(chunk.get());
+            recordGeneration(std::chrono::steady_clock::now() - generationStart);
+            chunk->setGenerated(true);
         }
 
-        // Generar el chunk FUERA del lock (permite que otros threads agreguen a la cola)
-        // Generar el chunk (llamada sincrónica interna al worker)
-        std::unique_ptr<Chunk> chunk;
+        m_completedChunks.push(std::move(chunk));
+    }
 
-        // OPTIMIZACIÓN: Intentar reutilizar del object pool
+    m_generationJobsInFlight.fetch_sub(1, std::memory_order_release);
+}
+
+std::unique_ptr<Chunk> World::acquireChunk(ChunkPos pos) {
+    std::unique_ptr<Chunk> chunk;
+
+    // OPTIMIZACIÓN: Intentar reutilizar del object pool
+    {
+        std::lock_guard<std::mutex> lock(m_chunkPoolMutex);
         if (!m_chunkPool.empty()) {
             chunk = std::move(m_chunkPool.back());
             m_chunkPool.pop_back();
-            chunk->clear();
-            chunk->setPosition(posToGenerate);
-        } else {
-            chunk = std::make_unique<Chunk>(posToGenerate);
         }
+    }
 
-        // Generar terreno
-        generateTerrain(chunk.get());
-        chunk->setGenerated(true);
+    if (chunk) {
+        // Limpiar y reconfigurar para nueva posición
+        chunk->clear();
+        chunk->setPosition(pos);
+    } else {
+        // Pool vacío, crear nuevo chunk
+        chunk = std::make_unique<Chunk>(pos);
+    }
+    return chunk;
+}
 
-        // Intentar insertar el chunk - si ya existe, descartar este
-        // try_emplace es thread-safe: solo inserta si la clave no existe
-        {
-            std::lock_guard<std::mutex> lock(m_chunkQueueMutex);
-            auto [it, inserted] = m_chunks.try_emplace(posToGenerate, std::move(chunk));
-
-            // Si no se insertó (ya existía), devolver al object pool
-            if (!inserted && it->second.get()) {
-                // El chunk generado no se usó, devolverlo al pool
-                // Nota: it->second es el chunk que ya existía, no el que acabamos de crear
-                // El chunk que creamos se destruye automáticamente porque unique_ptr se movió
-            }
-        }
+void World::releaseChunk(std::unique_ptr<Chunk> chunk) {
+    std::lock_guard<std::mutex> lock(m_chunkPoolMutex);
+    if (m_chunkPool.size() < CHUNK_POOL_LIMIT) {
+        m_chunkPool.push_back(std::move(chunk));
     }
 }
 
@@ -268,23 +545,37 @@ void World::chunkGenerationWorker() {
  * @brief Solicita generación asíncrona de un chunk
  * @param pos Posición del chunk a generar
  *
- * Agrega el chunk a la cola de generación para que el thread de
- * background lo genere. Si el chunk ya existe o ya está en cola,
- * no hace nada.
+ * Programa un job en el JobSystem para generar el chunk. Si el chunk ya
+ * existe o ya tiene un job pendiente, no hace nada.
  *
  * OPTIMIZACIÓN 6: Non-blocking chunk generation
  */
-void World::requestChunkGeneration(ChunkPos pos) {
-    std::lock_guard<std::mutex> lock(m_chunkQueueMutex);
+void World::requestChunkGeneration(ChunkPos pos, bool highPriority) {
+    // Solo el thread principal toca m_chunks y m_chunksInFlight: sin lock
+    if (m_chunks.find(pos) != m_chunks.end() || !m_chunksInFlight.insert(pos).second) {
+        return;
+    }
 
-    // Verificar si ya existe
-    if (m_chunks.find(pos) != m_chunks.end()) {
-        return;  // Ya existe
+    m_generationJobsInFlight.fetch_add(1, std::memory_order_relaxed);
+    TRACE_FLOW_BEGIN("chunk request", chunkTraceId(pos));
+    TRACE_COUNTER("generation queue", static_cast<int>(m_chunksInFlight.size()));
+
+    // Tier frío: los datos comprimidos se mueven al job
+    auto coldIt = m_coldChunks.find(pos);
+    if (coldIt != m_coldChunks.end()) {
+        std::vector<uint8_t> data = std::move(coldIt->second.data);
+        dropColdChunk(coldIt);
+        JobSystem::instance().scheduleHighPriority([this, pos, data = std::move(data)] {
+            thawChunkJob(pos, data);
+        });
+        return;
     }
 
-    // Agregar a la cola y notificar al worker
-    m_chunkGenerationQueue.push(pos);
-    m_chunkQueueCV.notify_one();
+    if (highPriority) {
+        JobSystem::instance().scheduleHighPriority([this, pos] { generateChunkJob(pos); });
+    } else {
+        JobSystem::instance().schedule([this, pos] { generateChunkJob(pos); });
+    }
 }
 
 void World::generateChunk(ChunkPos pos) {
@@ -293,28 +584,101 @@ void World::generateChunk(ChunkPos pos) {
         return;
     }
 
-    std::unique_ptr<Chunk> chunk;
-
-    // OPTIMIZACIÓN: Intentar reutilizar del object pool
-    if (!m_chunkPool.empty()) {
-        // Reutilizar chunk del pool
-        chunk = std::move(m_chunkPool.back());
-        m_chunkPool.pop_back();
-
-        // Limpiar y reconfigurar para nueva posición
-        chunk->clear();
-        chunk->setPosition(pos);
-    } else {
-        // Pool vacío, crear nuevo chunk
-        chunk = std::make_unique<Chunk>(pos);
+    // Una posición está en m_chunks o en el tier frío, nunca en ambos
+    auto coldIt = m_coldChunks.find(pos);
+    if (coldIt != m_coldChunks.end()) {
+        dropColdChunk(coldIt);
     }
 
+    std::unique_ptr<Chunk> chunk = acquireChunk(pos);
+
     // Generar terreno
+    auto generationStart = std::chrono::steady_clock::now();
     generateTerrain(chunk.get());
+    recordGeneration(std::chrono::steady_clock::now() - generationStart);
 
-    // Marcar como generado y almacenar
+    // Marcar como generado y publicar
     chunk->setGenerated(true);
-    m_chunks[pos] = std::move(chunk);
+    publishChunk(std::move(chunk));
+}
+
+/**
+ * @brief Publica los chunks terminados por los workers
+ * @param budgetMs Tiempo máximo de la llamada (ms); al menos se publica un chunk
+ * @return Cantidad de chunks publicados
+ *
+ * OPTIMIZACIÓN: Cuando muchos chunks terminan a la vez (teletransporte,
+ * zoom out) se reparten entre varios frames en lugar de producir un pico.
+ */
+int World::processCompletedChunks(double budgetMs) {
+    if (m_completedChunks.empty()) {
+        return 0;
+    }
+
+    TRACE_SCOPE("World::processCompletedChunks");
+    const auto start = std::chrono::steady_clock::now();
+    const auto budget = std::chrono::duration<double, std::milli>(budgetMs);
+
+    int published = 0;
+    std::unique_ptr<Chunk> chunk;
+    while (m_completedChunks.tryPop(chunk)) {
+        // Pedido anterior a loadDeltas: descartarlo y volver a pedir el chunk
+        if (!m_staleInFlight.empty() && m_staleInFlight.erase(chunk->getPosition())) {
+            const ChunkPos pos = chunk->getPosition();
+            m_chunksInFlight.erase(pos);
+            releaseChunk(std::move(chunk));
+            requestChunkGeneration(pos, true);
+            continue;
+        }
+        publishChunk(std::move(chunk));
+        published++;
+        if (std::chrono::steady_clock::now() - start >= budget) {
+            break;
+        }
+    }
+    return published;
+}
+
+void World::publishChunk(std::unique_ptr<Chunk> chunk) {
+    const ChunkPos pos = chunk->getPosition();
+    m_chunksInFlight.erase(pos);
+
+    // try_emplace no mueve el chunk si la clave ya existe (generateChunk síncrono)
+    auto [it, inserted] = m_chunks.try_emplace(pos, std::move(chunk));
+    if (!inserted) {
+        releaseChunk(std::move(chunk));
+        return;
+    }
+    Chunk* published = it->second.get();
+    published->setLastUsed(m_useClock);
+
+    // Ediciones guardadas sobre el terreno regenerado
+    if (!m_blockDeltas.empty()) {
+        auto deltaIt = m_blockDeltas.find(pos);
+        if (deltaIt != m_blockDeltas.end()) {
+            applyBlockDeltas(*published, deltaIt->second);
+            auto impostorIt = m_impostors.find(pos);
+            if (impostorIt != m_impostors.end()) {
+                copySurfaceToImpostor(*published, impostorIt->second);
+            }
+        }
+    }
+    m_residentBytes += published->getResidentBytes();
+
+    // Enlazar vecinos: el face culling de los bordes de ambos lados ya
+    // puede mirar los bloques del otro chunk
+    for (const ChunkNeighborOffset& offset : NEIGHBOR_OFFSETS) {
+        auto neighborIt = m_chunks.find(ChunkPos(pos.x + offset.dx, pos.z + offset.dz));
+        if (neighborIt != m_chunks.end()) {
+            published->setNeighbor(offset.side, neighborIt->second.get());
+            neighborIt->second->setNeighbor(offset.opposite, published);
+        }
+    }
+
+    // Conjunto visible: agregar si cae en la región (posiciones ordenadas)
+    if (std::binary_search(m_visiblePositions.begin(), m_visiblePositions.end(), pos, chunkPosLess)) {
+        m_visibleChunks.push_back(published);
+    }
 }
 
 /**
@@ -456,8 +820,16 @@ void World::generateTerrain(Chunk* chunk) {
                 chunk->setBlockUnsafe(x, y, z, blockType);
             }
 
+            // Resumen de superficie para el LOD lejano (se completa con el árbol abajo)
+            SurfaceColumn surface;
+            if (terrainHeight < BlockConfig::WORLD_HEIGHT) {
+                surface.groundType = (terrainHeight > 0) ? biomeBlock : BlockType::PIEDRA;
+                surface.groundY = static_cast<uint8_t>(terrainHeight);
+            }
+
             // Generar árboles con probabilidad 0.1 (10%) - árboles frecuentes
-            float treeChance = (m_rng() % 100) / 100.0f;  // Valor [0.0, 0.99]
+            // Hash de (semilla, columna): mismo resultado sin importar el orden de generación
+            float treeChance = (columnHash(m_seed, worldX, worldZ) % 100) / 100.0f;  // Valor [0.0, 0.99]
 
             if (treeChance < 0.1f && terrainHeight + 1 < BlockConfig::WORLD_HEIGHT) {
                 // Determinar tipo de árbol según bioma
@@ -477,10 +849,14 @@ void World::generateTerrain(Chunk* chunk) {
                 // Colocar el árbol un bloque encima de la superficie
                 if (treeType != BlockType::AIRE) {
                     // Colocar el árbol visual en terrainHeight + 1
-                    chunk->setBlockUnsafe(x, terrainHeight + 1, z, treeType);
+                    // OPTIMIZACIÓN: La variante de sprite se elige aquí una sola vez
+                    uint8_t treeVariant = RenderVariants::fromPosition(treeType, worldX, worldZ);
+                    chunk->setBlockUnsafe(x, terrainHeight + 1, z, treeType, treeVariant);
 
                     // Actualizar heightmap para incluir el árbol
                     chunk->setMaxY(x, z, terrainHeight + 1);
+                    surface.topType = treeType;
+                    surface.topVariant = treeVariant;
                 } else {
                     // Sin árbol, el heightmap es la superficie del terreno
                     chunk->setMaxY(x, z, terrainHeight);
@@ -489,8 +865,13 @@ void World::generateTerrain(Chunk* chunk) {
                 // No se generó árbol, el heightmap es la superficie del terreno
                 chunk->setMaxY(x, z, terrainHeight);
             }
+
+            chunk->setSurface(x, z, surface);
         }
     }
+
+    // Bounding volume vertical del chunk para frustum culling ajustado
+    chunk->updateHeightBounds();
 }
 
 /**
@@ -534,7 +915,7 @@ BlockType World::getBiomeFromNoise(float biomeValue) const {
  * @brief Obtiene todos los chunks alrededor de una posición
  * @param center ChunkPos central
  * @param radius Radio en chunks (ej: 3 devuelve 7x7=49 chunks)
- * @return Vector de punteros a chunks generados
+ * @param out Vector de salida con punteros a chunks generados
  *
  * Proceso:
  * 1. Iterar x desde center.x - radius hasta center.x + radius
@@ -542,19 +923,15 @@ BlockType World::getBiomeFromNoise(float biomeValue) const {
  * 3. Para cada ChunkPos:
  *    - Si no existe, generar el chunk
  *    - Si está generado, agregar al vector
- * 4. Devolver vector (puede estar vacío si ningún chunk está generado)
+ * 4. out queda vacío si ningún chunk está generado
  *
  * Se usa para obtener los chunks visibles desde la cámara/jugador.
  */
-std::vector<Chunk*> World::getChunksAround(ChunkPos center, int radius) {
-    // Pre-asignar capacidad esperada: (radius*2+1)²
-    const int expectedSize = (radius * 2 + 1) * (radius * 2 + 1);
-    std::vector<Chunk*> chunks;
-    chunks.reserve(expectedSize);
-
-    // Recopilar todas las posiciones que necesitamos
-    std::vector<ChunkPos> positions;
-    positions.reserve(expectedSize);
+void World::getChunksAround(ChunkPos center, int radius, std::vector<Chunk*>& out) {
+    // Posiciones en la arena del frame: (radius*2+1)² sin tocar el heap
+    const int side = radius * 2 + 1;
+    FrameVector<ChunkPos> positions;
+    positions.reserve(side * side);
 
     for (int x = center.x - radius; x <= center.x + radius; x++) {
         for (int z = center.z - radius; z <= center.z + radius; z++) {
@@ -562,38 +939,106 @@ std::vector<Chunk*> World::getChunksAround(ChunkPos center, int radius) {
         }
     }
 
-    // Copiar todos los punteros de chunks DENTRO del lock (evita use-after-free)
-    std::vector<Chunk*> chunksToCheck;
-    std::vector<ChunkPos> missingChunks;
+    getChunks(positions, out);
+}
 
-    {
-        std::lock_guard<std::mutex> lock(m_chunkQueueMutex);
-        chunksToCheck.reserve(expectedSize);
-        missingChunks.reserve(expectedSize);
+/**
+ * @brief Obtiene los chunks de un conjunto arbitrario de posiciones
+ * @param positions Posiciones de chunk a consultar
+ * @param out Vector de salida con punteros a chunks generados
+ *
+ * Igual que getChunksAround() pero sin imponer la forma cuadrada: se usa con
+ * el conjunto visible derivado del frustum (Camera::getVisibleChunks).
+ * Los chunks faltantes se encolan para generación asíncrona.
+ *
+ * OPTIMIZACIÓN: Sin reservas de heap por frame (out es del llamador y
+ * conserva su capacidad) y sin lock: el thread principal es el único que
+ * escribe en m_chunks.
+ */
+void World::getChunks(std::span<const ChunkPos> positions, std::vector<Chunk*>& out) {
+    TRACE_SCOPE("World::getChunks");
+    out.clear();
+    out.reserve(positions.size());
 
-        for (const ChunkPos& pos : positions) {
-            auto it = m_chunks.find(pos);
-            if (it != m_chunks.end()) {
-                chunksToCheck.push_back(it->second.get());
-            } else {
-                missingChunks.push_back(pos);
-            }
+    // Sin lock: m_chunks solo lo modifica el thread principal
+    for (const ChunkPos& pos : positions) {
+        auto it = m_chunks.find(pos);
+        if (it != m_chunks.end()) {
+            it->second->setLastUsed(m_useClock);
+            out.push_back(it->second.get());
+        } else {
+            requestChunkGeneration(pos);  // Faltante: job de generación (si no hay uno pendiente)
         }
     }
+}
 
-    // FUERA del lock: procesar los chunks y solicitar los faltantes
-    for (Chunk* chunk : chunksToCheck) {
-        if (chunk && chunk->isGenerated()) {
-            chunks.push_back(chunk);
+void World::getChunks(std::span<const ChunkPos> positions) {
+    TRACE_SCOPE("World::getChunks");
+    for (const ChunkPos& pos : positions) {
+        auto it = m_chunks.find(pos);
+        if (it != m_chunks.end()) {
+            it->second->setLastUsed(m_useClock);
+        } else {
+            requestChunkGeneration(pos);
         }
     }
+}
 
-    // Solicitar generación de chunks faltantes
-    for (const ChunkPos& pos : missingChunks) {
+/**
+ * @brief Pide por adelantado los chunks de una región futura
+ * @param positions Posiciones en orden de urgencia
+ * @return Cantidad de chunks pedidos (los que no existían ni estaban pendientes)
+ *
+ * OPTIMIZACIÓN: Prefetch predictivo. Los jobs van a la cola de alta
+ * prioridad del JobSystem: se generan antes que los pedidos normales ya
+ * encolados. Un chunk que ya tiene un job normal pendiente no se adelanta.
+ */
+int World::prefetchChunks(std::span<const ChunkPos> positions) {
+    TRACE_SCOPE("World::prefetchChunks");
+    const size_t pendingBefore = m_chunksInFlight.size();
+    for (const ChunkPos& pos : positions) {
+        requestChunkGeneration(pos, true);
+    }
+    return static_cast<int>(m_chunksInFlight.size() - pendingBefore);
+}
+
+int World::pregenerateChunks(std::span<const ChunkPos> positions, const std::function<void(int, int)>& onProgress) {
+    TRACE_SCOPE("World::pregenerateChunks");
+    for (const ChunkPos& pos : positions) {
         requestChunkGeneration(pos);
     }
 
-    return chunks;
+    auto countReady = [this, positions] {
+        int ready = 0;
+        for (const ChunkPos& pos : positions) {
+            ready += m_chunks.count(pos) ? 1 : 0;
+        }
+        return ready;
+    };
+
+    // El thread principal ejecuta jobs de generación junto a los workers y
+    // publica a medida que llegan: todos los núcleos trabajan hasta el final
+    const int total = static_cast<int>(positions.size());
+    JobSystem& jobSystem = JobSystem::instance();
+    int ready = countReady();
+    if (onProgress) {
+        onProgress(ready, total);
+    }
+    // Solo jobs de los workers: los de thread principal esperan a runMainThreadJobs()
+    while (ready < total) {
+        if (m_chunkGeneratorShouldStop.load(std::memory_order_acquire)) {
+            break;  // Los jobs pendientes se descartan: lo que falta no va a llegar
+        }
+        if (processCompletedChunks(std::numeric_limits<double>::infinity()) > 0) {
+            ready = countReady();
+            if (onProgress) {
+                onProgress(ready, total);
+            }
+        } else if (!jobSystem.runWorkerJob()) {
+            std::this_thread::yield();  // Los últimos jobs están en los workers
+        }
+    }
+    return ready;
 }
 
 /**
@@ -604,51 +1049,324 @@ std::vector<Chunk*> World::getChunksAround(ChunkPos center, int radius) {
  *
  * Algoritmo:
  * 1. Para cada chunk en el mapa:
- *    - Calcular distancia Manhattan: dist = |chunkX - centerX| + |chunkZ - centerZ|
- *    - Si distX > maxDistance O distZ > maxDistance: marcar para descarga
- * 2. Eliminar todos los chunks marcados
- * 3. unique_ptr libera la memoria automáticamente
+ *    - Calcular distancia Chebyshev: dist = max(|chunkX - centerX|, |chunkZ - centerZ|)
+ *    - Si dist > maxDistance: marcar para descarga
+ * 2. Eliminar todos los chunks marcados (y los del tier frío con el mismo criterio)
+ * 3. Los chunks vuelven al pool para reutilizarse
  *
- * Nota: Se usa distancia Manhattan (|dx| + |dz|) en lugar de euclidiana (sqrt(dx² + dz²))
- * porque es más rápida (no hay sqrt) y suficiente para este propósito.
+ * Nota: Chebyshev en lugar de euclidiana (no hay sqrt) y porque la zona que
+ * se conserva es el mismo cuadrado que usan evictChunks y compressIdleChunks.
+ * A diferencia de evictChunks descarga siempre, sin mirar el presupuesto:
+ * la usan los benchmarks para volver a un área fija entre repeticiones.
  *
  * Ejemplo con maxDistance=9:
  * - Si el jugador está en (0,0), el chunk (10,0) se descarga
  * - El chunk (9,0) se mantiene
- * - El chunk (5,5) se mantiene (distancia Manhattan = 10, pero distX=5, distZ=5)
+ * - El chunk (9,9) se mantiene (distancia Chebyshev = 9)
  */
 int World::unloadChunksFarFrom(ChunkPos center, int maxDistance) {
-    std::vector<ChunkPos> chunksToUnload;
+    FrameVector<ChunkPos> chunksToUnload;
 
     // Encontrar todos los chunks que están fuera del rango permitido
     for (const auto& pair : m_chunks) {
         ChunkPos pos = pair.first;
 
-        // Calcular distancia Manhattan desde el centro
+        // Calcular distancia Chebyshev desde el centro
         int distX = abs(pos.x - center.x);
         int distZ = abs(pos.z - center.z);
 
-        // Si el chunk está muy lejos en cualquiera de los ejes, marcarlo para descarga
+        // Si el chunk está muy lejos en alguno de los ejes, marcarlo para descarga
         if (distX > maxDistance || distZ > maxDistance) {
             chunksToUnload.push_back(pos);
         }
     }
 
-    // OPTIMIZACIÓN: Object Pooling - Devolver chunks al pool en lugar de destruir
     for (ChunkPos pos : chunksToUnload) {
-        auto it = m_chunks.find(pos);
-        if (it != m_chunks.end()) {
-            // Mover chunk al pool para reutilización
-            m_chunkPool.push_back(std::move(it->second));
+        unloadChunk(pos);
+    }
 
-            // Eliminar del mapa activo (el unique_ptr ahora es nullptr)
-            m_chunks.erase(it);
+    // El tier frío con el mismo criterio
+    for (auto it = m_coldChunks.begin(); it != m_coldChunks.end(); ) {
+        auto current = it++;
+        if (abs(current->first.x - center.x) > maxDistance || abs(current->first.z - center.z) > maxDistance) {
+            dropColdChunk(current);
         }
     }
 
+    // Los punteros del conjunto visible pueden haber quedado colgando
+    if (!chunksToUnload.empty()) {
+        m_visibleSetDirty = true;
+    }
+
     return static_cast<int>(chunksToUnload.size());
 }
 
+/**
+ * @brief Descarga chunks por LRU ponderado por distancia hasta entrar en el presupuesto
+ * @param center Posición central (cámara)
+ * @param keepDistance Distancia protegida (la región de carga actual)
+ * @return Cantidad de chunks descargados
+ *
+ * Puntaje de descarte = antigüedad + distancia. El reloj de uso avanza una
+ * vez por cambio de región visible (más o menos un chunk recorrido), así
+ * que ambos términos están en chunks: un chunk a 10 de distancia que se vio
+ * hace 5 cambios de región pesa lo mismo que uno a 5 que no se ve hace 10.
+ *
+ * Baja hasta 7/8 del presupuesto para no volver a descargar en cada
+ * actualización mientras se exploran zonas nuevas.
+ */
+int World::evictChunks(ChunkPos center, int keepDistance) {
+    if (m_residentBytes <= m_memoryBudgetBytes) {
+        return 0;
+    }
+
+    TRACE_SCOPE("World::evictChunks");
+    struct Candidate {
+        ChunkPos pos;
+        uint32_t score;
+    };
+    FrameVector<Candidate> candidates;
+    candidates.reserve(m_chunks.size());
+
+    for (const auto& pair : m_chunks) {
+        const ChunkPos pos = pair.first;
+        const int distance = std::max(abs(pos.x - center.x), abs(pos.z - center.z));
+        if (distance <= keepDistance) {
+            continue;
+        }
+        const uint32_t age = m_useClock - pair.second->getLastUsed();
+        candidates.push_back(Candidate{pos, age + static_cast<uint32_t>(distance)});
+    }
+    for (const auto& pair : m_coldChunks) {
+        const ChunkPos pos = pair.first;
+        const int distance = std::max(abs(pos.x - center.x), abs(pos.z - center.z));
+        if (distance > keepDistance) {
+            const uint32_t age = m_useClock - pair.second.lastUsed;
+            candidates.push_back(Candidate{pos, age + static_cast<uint32_t>(distance)});
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.score > b.score;
+    });
+
+    const size_t target = m_memoryBudgetBytes - m_memoryBudgetBytes / 8;
+    int evicted = 0;
+    for (const Candidate& candidate : candidates) {
+        if (m_residentBytes <= target) {
+            break;
+        }
+        auto coldIt = m_coldChunks.find(candidate.pos);
+        if (coldIt != m_coldChunks.end()) {
+            dropColdChunk(coldIt);
+        } else {
+            unloadChunk(candidate.pos);
+        }
+        evicted++;
+    }
+
+    // Los punteros del conjunto visible pueden haber quedado colgando
+    if (evicted > 0) {
+        m_visibleSetDirty = true;
+        m_chunksEvicted += evicted;
+    }
+    return evicted;
+}
+
+/**
+ * @brief Comprime los chunks sin usar fuera de la zona protegida
+ *
+ * Se comprime al buffer reutilizable y se copia a un vector de tamaño
+ * exacto: el tier frío no arrastra capacidad sobrante.
+ */
+int World::compressIdleChunks(ChunkPos center, int keepDistance, double budgetMs) {
+    TRACE_SCOPE("World::compressIdleChunks");
+    FrameVector<ChunkPos> idle;
+    for (const auto& pair : m_chunks) {
+        const ChunkPos pos = pair.first;
+        const int distance = std::max(abs(pos.x - center.x), abs(pos.z - center.z));
+        if (distance > keepDistance && m_useClock - pair.second->getLastUsed() >= COLD_AFTER_TICKS) {
+            idle.push_back(pos);
+        }
+    }
+    if (idle.empty()) {
+        return 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto budget = std::chrono::duration<double, std::milli>(budgetMs);
+    int compressed = 0;
+    for (ChunkPos pos : idle) {
+        const Chunk& chunk = *m_chunks.find(pos)->second;
+        if (!ChunkCodec::compress(chunk, m_compressBuffer)) {
+            continue;  // No cabe en el formato: queda cargado
+        }
+
+        ColdChunk cold;
+        cold.data.assign(m_compressBuffer.begin(), m_compressBuffer.end());
+        cold.lastUsed = chunk.getLastUsed();
+        m_coldBytes += cold.getResidentBytes();
+        m_residentBytes += cold.getResidentBytes();
+        m_coldChunks.emplace(pos, std::move(cold));
+
+        unloadChunk(pos);
+        compressed++;
+        if (std::chrono::steady_clock::now() - start >= budget) {
+            break;
+        }
+    }
+
+    // Los punteros del conjunto visible pueden haber quedado colgando
+    if (compressed > 0) {
+        m_visibleSetDirty = true;
+    }
+    return compressed;
+}
+
+void World::dropColdChunk(std::unordered_map<ChunkPos, ColdChunk>::iterator it) {
+    const size_t bytes = it->second.getResidentBytes();
+    m_coldBytes -= bytes;
+    m_residentBytes -= bytes;
+    m_coldChunks.erase(it);
+}
+
+void World::unloadChunk(ChunkPos pos) {
+    auto it = m_chunks.find(pos);
+    if (it == m_chunks.end()) {
+        return;
+    }
+
+    // Desenlazar de los vecinos: sus bordes vuelven a considerarse expuestos
+    for (const ChunkNeighborOffset& offset : NEIGHBOR_OFFSETS) {
+        auto neighborIt = m_chunks.find(ChunkPos(pos.x + offset.dx, pos.z + offset.dz));
+        if (neighborIt != m_chunks.end()) {
+            neighborIt->second->setNeighbor(offset.opposite, nullptr);
+        }
+    }
+
+    // OPTIMIZACIÓN: Object Pooling - Devolver el chunk al pool en lugar de destruirlo
+    m_residentBytes -= it->second->getResidentBytes();
+    releaseChunk(std::move(it->second));
+    m_chunks.erase(it);
+}
+
+/**
+ * @brief Define la región visible y reconstruye el conjunto visible
+ * @param positions Posiciones de chunk de la región
+ *
+ * Única operación del conjunto visible que recorre todas las posiciones:
+ * un lookup por posición y pedidos de generación de los faltantes.
+ */
+void World::setVisibleRegion(std::span<const ChunkPos> positions) {
+    // Ordenadas para que publishChunk compruebe la pertenencia con búsqueda binaria
+    m_visiblePositions.assign(positions.begin(), positions.end());
+    std::sort(m_visiblePositions.begin(), m_visiblePositions.end(), chunkPosLess);
+    m_useClock++;  // Reloj del LRU: un tick por región visible
+    rebuildVisibleSet();
+}
+
+void World::rebuildVisibleSet() {
+    TRACE_SCOPE("World::rebuildVisibleSet");
+    getChunks(m_visiblePositions, m_visibleChunks);
+    m_visibleSetDirty = false;
+}
+
+/**
+ * @brief Reconstruye el conjunto visible si hubo descargas
+ *
+ * Los chunks nuevos ya los agrega publishChunk: el frame habitual no hace nada.
+ */
+void World::updateVisibleSet() {
+    if (m_visibleSetDirty) {
+        rebuildVisibleSet();
+    }
+}
+
+void World::getImpostors(const std::vector<ChunkPos>& positions, std::vector<const ImpostorChunk*>& out) {
+    out.clear();
+    out.reserve(positions.size());
+
+    int generated = 0;
+    for (const ChunkPos& pos : positions) {
+        auto it = m_impostors.find(pos);
+        if (it == m_impostors.end()) {
+            // Presupuesto por frame: evitar picos al alejar el zoom de golpe
+            if (generated >= IMPOSTOR_GENERATION_BUDGET) {
+                continue;
+            }
+            it = m_impostors.emplace(pos, ImpostorChunk{}).first;
+            it->second.position = pos;
+            generateImpostor(it->second);
+            generated++;
+        }
+        out.push_back(&it->second);
+    }
+}
+
+int World::unloadImpostorsFarFrom(ChunkPos center, int maxDistance) {
+    int unloaded = 0;
+    for (auto it = m_impostors.begin(); it != m_impostors.end(); ) {
+        int dx = abs(it->first.x - center.x);
+        int dz = abs(it->first.z - center.z);
+        if (dx > maxDistance || dz > maxDistance) {
+            it = m_impostors.erase(it);
+            unloaded++;
+        } else {
+            ++it;
+        }
+    }
+    return unloaded;
+}
+
+/**
+ * @brief Genera la superficie de un impostor con ruido 2D
+ *
+ * Solo evalúa el ruido de terreno y de bioma por columna (128 muestras 2D),
+ * frente al ruido 3D de cuevas y las 2048 escrituras de bloque de generateTerrain.
+ * Un chunk con deltas no coincide con el ruido: su superficie sale de los
+ * bloques (el chunk residente o uno generado aquí con sus deltas aplicados).
+ */
+void World::generateImpostor(ImpostorChunk& impostor) {
+    auto deltaIt = m_blockDeltas.find(impostor.position);
+    if (deltaIt != m_blockDeltas.end()) {
+        auto chunkIt = m_chunks.find(impostor.position);
+        if (chunkIt != m_chunks.end()) {
+            copySurfaceToImpostor(*chunkIt->second, impostor);
+            return;
+        }
+        std::unique_ptr<Chunk> chunk = acquireChunk(impostor.position);
+        generateTerrain(chunk.get());
+        applyBlockDeltas(*chunk, deltaIt->second);
+        copySurfaceToImpostor(*chunk, impostor);
+        releaseChunk(std::move(chunk));
+        return;
+    }
+
+    const int worldXStart = impostor.position.x * BlockConfig::CHUNK_SIZE;
+    const int worldZStart = impostor.position.z * BlockConfig::CHUNK_SIZE;
+
+    int minHeight = BlockConfig::WORLD_HEIGHT;
+    int maxHeight = 0;
+
+    for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+        for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+            int worldX = worldXStart + x;
+            int worldZ = worldZStart + z;
+            int terrainHeight = getTerrainHeight(worldX, worldZ);
+
+            SurfaceColumn& surface = impostor.surface[x + z * BlockConfig::CHUNK_SIZE];
+            surface.groundType = getBiomeAt(worldX, worldZ, terrainHeight);
+            surface.groundY = static_cast<uint8_t>(terrainHeight);
+
+            minHeight = std::min(minHeight, terrainHeight);
+            maxHeight = std::max(maxHeight, terrainHeight);
+        }
+    }
+
+    impostor.minHeight = minHeight;
+    impostor.maxHeight = maxHeight;
+}
+
 /**
  * @brief Obtiene la altura del terreno en una posición mundial
  * @return Altura Y del bloque sólido más alto
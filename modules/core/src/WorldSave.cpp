@@ -0,0 +1,184 @@
+/**
+ * @file WorldSave.cpp
+ * @brief Implementación del guardado por deltas
+ */
+
+#include "core/WorldSave.hpp"
+#include "utils/AtomicFile.hpp"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+constexpr char MAGIC[4] = {'I', 'G', 'W', 'S'};
+constexpr uint16_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 4 + 2 + 4 + 4;
+constexpr size_t CHUNK_HEADER_SIZE = 4 + 4 + 2;
+constexpr size_t DELTA_SIZE = 2 + 1;
+
+// Serialización little-endian explícita (independiente de la plataforma)
+void putU8(std::vector<uint8_t>& out, uint8_t value) {
+    out.push_back(value);
+}
+
+void putU16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+/**
+ * @brief Lector secuencial sobre el archivo ya cargado en memoria
+ */
+struct Reader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+
+    bool getU8(uint8_t& value) {
+        if (size - offset < 1) return false;
+        value = data[offset++];
+        return true;
+    }
+
+    bool getU16(uint16_t& value) {
+        if (size - offset < 2) return false;
+        value = static_cast<uint16_t>(data[offset] | (data[offset + 1] << 8));
+        offset += 2;
+        return true;
+    }
+
+    bool getU32(uint32_t& value) {
+        if (size - offset < 4) return false;
+        value = 0;
+        for (int i = 0; i < 4; i++) {
+            value |= static_cast<uint32_t>(data[offset + i]) << (i * 8);
+        }
+        offset += 4;
+        return true;
+    }
+};
+
+bool readHeader(Reader& reader, uint32_t& seed, uint32_t& chunkCount) {
+    uint16_t version = 0;
+    if (reader.size < HEADER_SIZE || std::memcmp(reader.data, MAGIC, 4) != 0) {
+        return false;
+    }
+    reader.offset = 4;
+    return reader.getU16(version) && version >= 1 && version <= VERSION &&
+           reader.getU32(seed) && reader.getU32(chunkCount);
+}
+
+bool loadFile(const std::string& path, std::vector<uint8_t>& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+} // namespace
+
+namespace WorldSave {
+
+bool write(const std::string& path, uint32_t seed, const std::vector<ChunkDelta>& chunks,
+           size_t* bytesWritten) {
+    // Serializar todo en memoria: una sola escritura al archivo
+    size_t totalSize = HEADER_SIZE;
+    for (const ChunkDelta& chunk : chunks) {
+        totalSize += CHUNK_HEADER_SIZE + chunk.blocks.size() * DELTA_SIZE;
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(totalSize);
+    buffer.insert(buffer.end(), MAGIC, MAGIC + 4);
+    putU16(buffer, VERSION);
+    putU32(buffer, seed);
+    putU32(buffer, static_cast<uint32_t>(chunks.size()));
+
+    for (const ChunkDelta& chunk : chunks) {
+        putU32(buffer, static_cast<uint32_t>(chunk.pos.x));
+        putU32(buffer, static_cast<uint32_t>(chunk.pos.z));
+        putU16(buffer, static_cast<uint16_t>(chunk.blocks.size()));  // <= DenseBlockStorage::MAX_BLOCKS
+        for (const BlockDelta& delta : chunk.blocks) {
+            putU16(buffer, delta.index);
+            putU8(buffer, static_cast<uint8_t>(delta.type));
+        }
+    }
+
+    // Archivo temporal + rename: un guardado interrumpido no pisa el anterior
+    if (!writeFileAtomic(path, buffer.data(), buffer.size())) {
+        return false;
+    }
+
+    if (bytesWritten) {
+        *bytesWritten = buffer.size();
+    }
+    return true;
+}
+
+bool read(const std::string& path, uint32_t& seed, std::vector<ChunkDelta>& chunks) {
+    std::vector<uint8_t> buffer;
+    if (!loadFile(path, buffer)) {
+        return false;
+    }
+
+    Reader reader{buffer.data(), buffer.size()};
+    uint32_t chunkCount = 0;
+    if (!readHeader(reader, seed, chunkCount)) {
+        return false;
+    }
+
+    // Cada chunk ocupa al menos su cabecera: descartar cantidades imposibles
+    // antes de reservar
+    if (chunkCount > (reader.size - reader.offset) / CHUNK_HEADER_SIZE) {
+        return false;
+    }
+
+    chunks.clear();
+    chunks.resize(chunkCount);
+    for (ChunkDelta& chunk : chunks) {
+        uint32_t x = 0;
+        uint32_t z = 0;
+        uint16_t count = 0;
+        if (!reader.getU32(x) || !reader.getU32(z) || !reader.getU16(count) ||
+            count > DenseBlockStorage::MAX_BLOCKS || count * DELTA_SIZE > reader.size - reader.offset) {
+            return false;
+        }
+        chunk.pos = ChunkPos(static_cast<int32_t>(x), static_cast<int32_t>(z));
+        chunk.blocks.resize(count);
+
+        for (BlockDelta& delta : chunk.blocks) {
+            uint8_t type = 0;
+            if (!reader.getU16(delta.index) || !reader.getU8(type) ||
+                delta.index >= DenseBlockStorage::MAX_BLOCKS ||
+                type >= static_cast<uint8_t>(BlockType::TOTAL_TIPOS)) {
+                return false;
+            }
+            delta.type = static_cast<BlockType>(type);
+        }
+    }
+    return reader.offset == reader.size;
+}
+
+bool readSeed(const std::string& path, uint32_t& seed) {
+    std::ifstream file(path, std::ios::binary);
+    uint8_t header[HEADER_SIZE];
+    if (!file.is_open() ||
+        !file.read(reinterpret_cast<char*>(header), static_cast<std::streamsize>(HEADER_SIZE))) {
+        return false;
+    }
+
+    Reader reader{header, HEADER_SIZE};
+    uint32_t chunkCount = 0;
+    return readHeader(reader, seed, chunkCount);
+}
+
+} // namespace WorldSave
@@ -0,0 +1,155 @@
+/**
+ * @file WorldSnapshot.cpp
+ * @brief Escritura y mapeo de los snapshots del mundo
+ */
+
+#include "core/WorldSnapshot.hpp"
+#include "utils/AtomicFile.hpp"
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+static_assert(std::endian::native == std::endian::little,
+              "El snapshot usa el orden de bytes nativo (little-endian)");
+
+namespace {
+
+size_t alignUp(size_t offset) {
+    const size_t alignment = WorldSnapshot::ALIGNMENT;
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+uint32_t fnv1a(const uint8_t* data, size_t size, uint32_t hash = 2166136261u) {
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/** @brief Checksum del archivo con el campo Header::checksum tomado como 0 */
+uint32_t fileChecksum(const uint8_t* data, size_t size) {
+    constexpr size_t fieldOffset = offsetof(WorldSnapshot::Header, checksum);
+    constexpr uint8_t zero[sizeof(uint32_t)] = {};
+    uint32_t hash = fnv1a(data, fieldOffset);
+    hash = fnv1a(zero, sizeof(zero), hash);
+    return fnv1a(data + fieldOffset + sizeof(zero), size - fieldOffset - sizeof(zero), hash);
+}
+
+bool isValidView(const WorldSnapshot::ViewState& view) {
+    const float values[] = {view.playerX, view.playerY, view.playerZ,
+                            view.cameraX, view.cameraY, view.cameraZ, view.zoom};
+    for (float value : values) {
+        if (!std::isfinite(value)) {
+            return false;
+        }
+    }
+    return view.zoom > 0.0f;
+}
+
+} // namespace
+
+namespace WorldSnapshot {
+
+bool write(const std::string& path, uint32_t seed, const ViewState& view,
+           std::span<const ChunkData> chunks, std::span<const DeltaRecord> deltas,
+           size_t* bytesWritten) {
+    // Calcular el layout completo antes de escribir: un único buffer y una
+    // única escritura al archivo
+    const size_t chunkTableOffset = alignUp(sizeof(Header));
+    const size_t deltaTableOffset = alignUp(chunkTableOffset + chunks.size() * sizeof(ChunkEntry));
+    size_t dataOffset = alignUp(deltaTableOffset + deltas.size() * sizeof(DeltaRecord));
+
+    std::vector<ChunkEntry> table(chunks.size());
+    for (size_t i = 0; i < chunks.size(); i++) {
+        table[i].x = chunks[i].pos.x;
+        table[i].z = chunks[i].pos.z;
+        table[i].offset = static_cast<uint32_t>(dataOffset);
+        table[i].size = static_cast<uint32_t>(chunks[i].data.size());
+        dataOffset = alignUp(dataOffset + chunks[i].data.size());
+    }
+    if (dataOffset > UINT32_MAX) {
+        return false;  // Los offsets son de 32 bits
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.headerSize = sizeof(Header);
+    header.seed = seed;
+    header.chunkCount = static_cast<uint32_t>(chunks.size());
+    header.deltaCount = static_cast<uint32_t>(deltas.size());
+    header.chunkTableOffset = static_cast<uint32_t>(chunkTableOffset);
+    header.deltaTableOffset = static_cast<uint32_t>(deltaTableOffset);
+    header.view = view;
+    header.fileSize = dataOffset;
+
+    // El relleno de alineación queda en cero
+    std::vector<uint8_t> buffer(dataOffset, 0);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    if (!table.empty()) {
+        std::memcpy(buffer.data() + chunkTableOffset, table.data(), table.size() * sizeof(ChunkEntry));
+    }
+    if (!deltas.empty()) {
+        std::memcpy(buffer.data() + deltaTableOffset, deltas.data(), deltas.size() * sizeof(DeltaRecord));
+    }
+    for (size_t i = 0; i < chunks.size(); i++) {
+        std::memcpy(buffer.data() + table[i].offset, chunks[i].data.data(), chunks[i].data.size());
+    }
+    header.checksum = fileChecksum(buffer.data(), buffer.size());
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    // Archivo temporal + rename: un volcado interrumpido no pisa el anterior
+    if (!writeFileAtomic(path, buffer.data(), buffer.size())) {
+        return false;
+    }
+
+    if (bytesWritten) {
+        *bytesWritten = buffer.size();
+    }
+    return true;
+}
+
+bool MappedSnapshot::open(const std::string& path) {
+    close();
+    if (!m_file.open(path)) {
+        return false;
+    }
+
+    const uint8_t* data = m_file.data();
+    const size_t size = m_file.size();
+    const Header* header = reinterpret_cast<const Header*>(data);
+    if (size < sizeof(Header) ||
+        std::memcmp(header->magic, MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != VERSION || header->headerSize != sizeof(Header) ||
+        header->fileSize != size || header->checksum != fileChecksum(data, size) ||
+        !isValidView(header->view)) {
+        m_file.close();
+        return false;
+    }
+
+    // Tablas alineadas y dentro del archivo (el mapeo empieza alineado a página)
+    const size_t chunkTableEnd = header->chunkTableOffset + size_t(header->chunkCount) * sizeof(ChunkEntry);
+    const size_t deltaTableEnd = header->deltaTableOffset + size_t(header->deltaCount) * sizeof(DeltaRecord);
+    if (header->chunkTableOffset % ALIGNMENT != 0 || header->deltaTableOffset % ALIGNMENT != 0 ||
+        chunkTableEnd > size || deltaTableEnd > size) {
+        m_file.close();
+        return false;
+    }
+
+    const ChunkEntry* chunks = reinterpret_cast<const ChunkEntry*>(data + header->chunkTableOffset);
+    for (uint32_t i = 0; i < header->chunkCount; i++) {
+        if (size_t(chunks[i].offset) + chunks[i].size > size) {
+            m_file.close();
+            return false;
+        }
+    }
+
+    m_header = header;
+    m_chunks = std::span<const ChunkEntry>(chunks, header->chunkCount);
+    m_deltas = std::span<const DeltaRecord>(
+        reinterpret_cast<const DeltaRecord*>(data + header->deltaTableOffset), header->deltaCount);
+    return true;
+}
+
+} // namespace WorldSnapshot
@@ -0,0 +1,268 @@
+/**
+ * @file RenderTiles.hpp
+ * @brief Lista de tiles en layout SoA y ordenación por profundidad key/index
+ *
+ * Este archivo no depende de SDL: lo usan el Renderer y los benchmarks.
+ *
+ * OPTIMIZACIÓN: Structure of Arrays + radix sort sobre pares (clave, índice).
+ * - Cada campo del tile vive en su propio array contiguo
+ * - El sort solo mueve pares empaquetados de 32 o 64 bits, nunca structs
+ * - El número de pasadas depende del rango real de profundidades
+ * - Los buffers temporales son persistentes (sin allocations por frame)
+ */
+
+#pragma once
+
+#include "core/Block.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+
+/**
+ * @struct TileList
+ * @brief Tiles a dibujar en layout SoA (Structure of Arrays)
+ *
+ * Campos paralelos indexados por el mismo índice de tile:
+ * - x, y: posición en pantalla (anclaje inferior-centro del sprite)
+ * - type, variant: tipo de bloque y variante visual (lookup en la tabla de UVs)
+ * - depth: clave de profundidad isométrica = worldX + worldZ + worldY*2
+ *
+ * La clave de profundidad se calcula UNA vez al insertar el tile.
+ */
+struct TileList {
+    std::vector<float> x;             ///< Posición X en pantalla
+    std::vector<float> y;             ///< Posición Y en pantalla
+    std::vector<BlockType> type;      ///< Tipo de bloque
+    std::vector<uint8_t> variant;     ///< Variante visual (elegida en generación)
+    std::vector<int32_t> depth;       ///< Clave de profundidad (worldX + worldZ + worldY*2)
+
+    /** @brief Cantidad de tiles */
+    size_t size() const { return depth.size(); }
+
+    /**
+     * @brief Vacía la lista manteniendo la capacidad
+     */
+    void clear() {
+        x.clear();
+        y.clear();
+        type.clear();
+        variant.clear();
+        depth.clear();
+    }
+
+    /**
+     * @brief Pre-asigna capacidad en todos los arrays
+     * @param capacity Cantidad de tiles esperada
+     */
+    void reserve(size_t capacity) {
+        x.reserve(capacity);
+        y.reserve(capacity);
+        type.reserve(capacity);
+        variant.reserve(capacity);
+        depth.reserve(capacity);
+    }
+
+    /**
+     * @brief Agrega un tile
+     * @param screenX, screenY Posición en pantalla
+     * @param blockType Tipo de bloque
+     * @param blockVariant Variante visual del bloque
+     * @param wx, wy, wz Coordenadas mundiales (solo se usan para la clave de profundidad)
+     * @return Índice del tile agregado
+     */
+    uint32_t push(float screenX, float screenY, BlockType blockType, uint8_t blockVariant,
+                  int wx, int wy, int wz) {
+        x.push_back(screenX);
+        y.push_back(screenY);
+        type.push_back(blockType);
+        variant.push_back(blockVariant);
+        depth.push_back(wx + wz + wy * 2);
+        return static_cast<uint32_t>(depth.size() - 1);
+    }
+};
+
+/**
+ * @brief Handle de sprite dinámico resuelto una vez (ver TextureManager::getSpriteHandle)
+ */
+using SpriteHandle = uint16_t;
+
+constexpr SpriteHandle INVALID_SPRITE = std::numeric_limits<SpriteHandle>::max();  ///< Handle inválido
+
+/**
+ * @struct SpriteList
+ * @brief Sprites dinámicos (jugador, NPCs, partículas) enviados en un frame
+ *
+ * Capa separada del terreno: los sprites se ordenan solo entre sí y se
+ * intercalan con el flujo ya ordenado de tiles en su profundidad, en lugar
+ * de re-ordenar todo el terreno junto con ellos.
+ *
+ * Se guardan en coordenadas mundiales; el Renderer los proyecta al dibujar.
+ */
+struct SpriteList {
+    std::vector<float> worldX;           ///< Posición X mundial
+    std::vector<float> worldY;           ///< Posición Y mundial
+    std::vector<float> worldZ;           ///< Posición Z mundial
+    std::vector<SpriteHandle> handle;    ///< Textura del sprite
+    std::vector<int32_t> depth;          ///< Clave de profundidad (misma fórmula que TileList)
+
+    /** @brief Cantidad de sprites */
+    size_t size() const { return depth.size(); }
+
+    /** @brief Vacía la lista manteniendo la capacidad */
+    void clear() {
+        worldX.clear();
+        worldY.clear();
+        worldZ.clear();
+        handle.clear();
+        depth.clear();
+    }
+
+    /**
+     * @brief Agrega un sprite
+     * @param spriteHandle Handle de textura
+     * @param wx, wy, wz Posición mundial (anclaje en la base del sprite)
+     */
+    void push(SpriteHandle spriteHandle, float wx, float wy, float wz) {
+        worldX.push_back(wx);
+        worldY.push_back(wy);
+        worldZ.push_back(wz);
+        handle.push_back(spriteHandle);
+        depth.push_back(static_cast<int>(wx) + static_cast<int>(wz) + static_cast<int>(wy) * 2);
+    }
+};
+
+/**
+ * @class TileDepthSorter
+ * @brief LSD radix sort estable de pares (profundidad, índice)
+ *
+ * Devuelve el orden de dibujo back-to-front como array de índices.
+ *
+ * Empaquetado:
+ * - key = depth - minDepth (sin signo, rango real del frame)
+ * - par = (key << indexBits) | índice
+ * - Si keyBits + indexBits <= 32 se usan pares de 32 bits, si no de 64
+ *
+ * Pasadas: ceil(keyBits / 8) de 8 bits cada una, solo sobre los bits de
+ * la clave. Las pasadas donde todos los elementos caen en el mismo bucket
+ * se saltan. Como el orden de entrada es el orden de índices y el sort es
+ * estable, los empates conservan el orden de inserción.
+ *
+ * Ejemplo: 200k tiles (18 bits de índice) con rango de profundidad < 16384
+ * (14 bits) caben en 32 bits y se ordenan en 2 pasadas en lugar de 4.
+ */
+class TileDepthSorter {
+public:
+    /**
+     * @brief Ordena por profundidad
+     * @param depth Array de claves de profundidad
+     * @param count Cantidad de elementos
+     * @return Referencia al orden resultante (válida hasta la siguiente llamada)
+     */
+    const std::vector<uint32_t>& sort(const int32_t* depth, size_t count) {
+        m_order.resize(count);
+        if (count == 0) {
+            m_passes = 0;
+            return m_order;
+        }
+
+        int32_t minDepth = depth[0];
+        int32_t maxDepth = depth[0];
+        for (size_t i = 1; i < count; i++) {
+            if (depth[i] < minDepth) minDepth = depth[i];
+            if (depth[i] > maxDepth) maxDepth = depth[i];
+        }
+
+        const uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(maxDepth) - minDepth);
+        const int keyBits = bitWidth(range);
+        const int indexBits = bitWidth(static_cast<uint32_t>(count - 1));
+
+        if (keyBits + indexBits <= 32 && indexBits < 32) {
+            sortPacked<uint32_t>(depth, count, minDepth, keyBits, indexBits, m_pairs32, m_temp32);
+        } else {
+            sortPacked<uint64_t>(depth, count, minDepth, keyBits, 32, m_pairs64, m_temp64);
+        }
+        return m_order;
+    }
+
+    /** @brief Pasadas de 8 bits ejecutadas en el último sort (diagnóstico) */
+    int getLastPassCount() const { return m_passes; }
+
+private:
+    std::vector<uint32_t> m_order;    ///< Orden resultante (índices de tile)
+    std::vector<uint32_t> m_pairs32;  ///< Pares empaquetados de 32 bits (persistente)
+    std::vector<uint32_t> m_temp32;   ///< Buffer temporal de 32 bits (persistente)
+    std::vector<uint64_t> m_pairs64;  ///< Pares empaquetados de 64 bits (persistente)
+    std::vector<uint64_t> m_temp64;   ///< Buffer temporal de 64 bits (persistente)
+    int m_passes = 0;                 ///< Pasadas ejecutadas en el último sort
+
+    /** @brief Bits necesarios para representar value (0 -> 0) */
+    static int bitWidth(uint32_t value) {
+        int bits = 0;
+        while (value) {
+            bits++;
+            value >>= 1;
+        }
+        return bits;
+    }
+
+    template <typename Pair>
+    void sortPacked(const int32_t* depth, size_t count, int32_t minDepth,
+                    int keyBits, int indexBits,
+                    std::vector<Pair>& pairs, std::vector<Pair>& temp) {
+        pairs.resize(count);
+        temp.resize(count);
+
+        // Empaquetar (clave relativa, índice)
+        for (size_t i = 0; i < count; i++) {
+            Pair key = static_cast<Pair>(static_cast<uint32_t>(static_cast<int64_t>(depth[i]) - minDepth));
+            pairs[i] = (key << indexBits) | static_cast<Pair>(i);
+        }
+
+        // Histogramas de todas las pasadas en una sola lectura
+        const int passCount = (keyBits + 7) / 8;
+        size_t histograms[4][256] = {};
+        for (size_t i = 0; i < count; i++) {
+            for (int pass = 0; pass < passCount; pass++) {
+                histograms[pass][(pairs[i] >> (indexBits + pass * 8)) & 0xFF]++;
+            }
+        }
+
+        Pair* src = pairs.data();
+        Pair* dst = temp.data();
+        m_passes = 0;
+
+        for (int pass = 0; pass < passCount; pass++) {
+            size_t* countPerBucket = histograms[pass];
+            const int shift = indexBits + pass * 8;
+
+            // Saltar pasadas triviales (todos en el mismo bucket)
+            if (countPerBucket[(src[0] >> shift) & 0xFF] == count) {
+                continue;
+            }
+
+            // Conteos -> posiciones acumuladas
+            size_t total = 0;
+            for (int b = 0; b < 256; b++) {
+                size_t oldCount = countPerBucket[b];
+                countPerBucket[b] = total;
+                total += oldCount;
+            }
+
+            for (size_t i = 0; i < count; i++) {
+                Pair value = src[i];
+                dst[countPerBucket[(value >> shift) & 0xFF]++] = value;
+            }
+
+            std::swap(src, dst);
+            m_passes++;
+        }
+
+        // Extraer índices
+        const Pair indexMask = (indexBits >= static_cast<int>(sizeof(Pair) * 8))
+            ? ~Pair(0) : ((Pair(1) << indexBits) - 1);
+        for (size_t i = 0; i < count; i++) {
+            m_order[i] = static_cast<uint32_t>(src[i] & indexMask);
+        }
+    }
+};
@@ -11,8 +11,13 @@
 
 #include "core/Chunk.hpp"
 #include "core/Camera.hpp"
+#include "core/Profiler.hpp"
+#include "rendering/RenderTiles.hpp"
+#include "rendering/TextRenderer.hpp"
+#include "rendering/TileListBuilder.hpp"
 #include <SDL2/SDL.h>
 #include <stb_image.h>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -29,7 +34,6 @@ struct RenderTile {
     BlockType type;   ///< Tipo de bloque (determina la textura)
     int worldY;       ///< Altura en el mundo (para orden de profundidad)
     int worldX, worldZ; ///< Coordenadas mundiales X y Z (para selección de árbol)
-    bool isPlayer;    ///< true si este tile representa al jugador (para renderizado especial)
 };
 
 /**
@@ -47,6 +51,8 @@ struct RenderTile {
  */
 class TextureManager {
 public:
+    static constexpr int MAX_TILE_SPRITE_SIZE = TileListBuilder::MAX_TILE_SPRITE_SIZE;  ///< Lado del sprite de tile más grande (árboles 64x64)
+
     /**
      * @brief Información de textura con dimensiones cacheadas
      */
@@ -132,12 +138,12 @@ public:
     void updateScaledDimensions(float zoom);
 
     /**
-     * @brief Inicializa el cache de sprite rects de árboles
+     * @brief Construye la tabla de UVs por (tipo, variante)
      *
-     * Pre-calcula todos los rects (180 total = 3 tipos × 60 sprites) para evitar
-     * cálculos de hash, módulo y división en renderWorld(). Se llama una vez en loadAllTextures().
+     * Pre-calcula el rect fuente de cada tipo de bloque y de cada variante de
+     * árbol. Se llama una vez en loadAllTextures().
      */
-    void initializeTreeSpriteCache();
+    void initializeSpriteRectTable();
 
     /**
      * @brief Obtiene el sprite sheet completo
@@ -157,18 +163,35 @@ public:
     SDL_Rect getSpriteSheetRect(BlockType type) const;
 
     /**
-     * @brief Obtiene el rectángulo fuente para un árbol del sprite sheet de árboles
-     * @param type Tipo de árbol (ARBOL_SECO, ARBOL_GRASS, ARBOL_SANGRE)
-     * @param worldX Coordenada X mundial (para selección aleatoria)
-     * @param worldZ Coordenada Z mundial (para selección aleatoria)
-     * @return SDL_Rect con el área del sprite sheet correspondiente al árbol
+     * @brief Resuelve un handle de sprite dinámico por nombre de textura
+     * @param name Nombre de la textura (ej: "player")
+     * @return Handle para submitSprite(), o INVALID_SPRITE si no existe
+     *
+     * Llamar una vez al inicializar; el handle evita búsquedas por string
+     * y SDL_QueryTexture en cada frame.
+     */
+    SpriteHandle getSpriteHandle(const std::string& name);
+
+    /**
+     * @brief Obtiene la textura y dimensiones escaladas de un sprite
+     * @param handle Handle devuelto por getSpriteHandle()
+     * @return Puntero a TextureInfo o nullptr si el handle es inválido
+     */
+    const TextureInfo* getSpriteInfo(SpriteHandle handle) const {
+        return handle < m_spriteHandles.size() ? m_spriteHandles[handle] : nullptr;
+    }
+
+    /**
+     * @brief Obtiene el rectángulo fuente de un bloque por tipo y variante
+     * @param type Tipo de bloque
+     * @param variant Variante visual (elegida al generar el chunk, ver RenderVariants)
+     * @return SDL_Rect del sprite (w = h = 0 si no tiene sprite)
      *
-     * Los árboles se distribuyen en:
-     * - Fila 1 (0-11): Árboles secos para biomas secos
-     * - Filas 2-3 (12-35): Árboles vivos para biomas grass
-     * - Filas 4-5 (36-59): Árboles de sangre para biomas blood_grass
+     * OPTIMIZACIÓN: Lookup directo en tabla pre-calculada, sin hash por frame.
      */
-    SDL_Rect getTreeSpriteRect(BlockType type, int worldX, int worldZ) const;
+    const SDL_Rect& getSpriteRect(BlockType type, uint8_t variant) const {
+        return m_spriteRects[static_cast<int>(type)][variant];
+    }
 
 private:
     SDL_Renderer* m_renderer; ///< Renderer SDL2 para crear texturas
@@ -185,12 +208,11 @@ private:
     static constexpr int TREE_SPRITE_SIZE = 64;  ///< Tamaño de cada árbol en el sprite sheet (64x64)
     static constexpr int TREE_SPRITE_COLUMNS = 12;  ///< 12 columnas de árboles
 
-    // OPTIMIZACIÓN FASE 2: Cache pre-calculado de sprite rects de árboles
-    static constexpr int TREE_SPRITE_COUNT = 60;  // Total de sprites de árbol (5 filas × 12 columnas)
-    struct TreeSpriteCache {
-        SDL_Rect rects[3][TREE_SPRITE_COUNT];  // [treeType][spriteIndex] -> 3 tipos × 60 sprites
-        bool initialized = false;
-    } m_treeSpriteCache;
+    std::vector<TextureInfo*> m_spriteHandles;  ///< Texturas de sprites dinámicos indexadas por SpriteHandle
+
+    // OPTIMIZACIÓN: Tabla de UVs pre-calculada indexada por [BlockType][variante]
+    std::array<std::array<SDL_Rect, RenderVariants::MAX_VARIANTS>,
+               static_cast<int>(BlockType::TOTAL_TIPOS)> m_spriteRects{};
 };
 
 /**
@@ -271,25 +293,44 @@ public:
     /**
      * @brief Renderiza el mundo (todos los chunks visibles)
      * @param chunks Vector de chunks a renderizar
+     * @param impostors Impostores de horizonte (solo superficie) más allá de los chunks completos
      * @param camera Cámara para proyección
-     * @param playerX Posición X del jugador (opcional, para depth sorting)
-     * @param playerY Posición Y del jugador (opcional, para depth sorting)
-     * @param playerZ Posición Z del jugador (opcional, para depth sorting)
      *
      * Pipeline completo:
      * 1. Recopilar todos los tiles de todos los chunks
-     * 2. Agregar jugador al render list si se proporcionan coordenadas
+     * 2. Ordenar los sprites dinámicos enviados con submitSprite()
      * 3. Aplicar frustum culling (descartar tiles fuera de pantalla)
      * 4. Ordenar por profundidad (Y de mundo)
-     * 5. Renderizar cada tile ordenado
+     * 5. Renderizar tiles y sprites intercalados por profundidad (merge)
      *
      * Optimizaciones:
      * - Solo renderiza bloques sólidos
      * - Frustum culling con margen de 100px
      * - Sort por altura Y (no por screenX + screenY)
      */
-    void renderWorld(const std::vector<Chunk*>& chunks, const Camera& camera,
-                     float playerX = 0.0f, float playerY = 0.0f, float playerZ = 0.0f);
+    void renderWorld(const std::vector<Chunk*>& chunks,
+                     const std::vector<const ImpostorChunk*>& impostors, const Camera& camera);
+
+    /**
+     * @brief Resuelve un handle de sprite dinámico (ver TextureManager::getSpriteHandle)
+     * @param name Nombre de la textura
+     * @return Handle para submitSprite()
+     */
+    SpriteHandle getSpriteHandle(const std::string& name) { return m_textureManager.getSpriteHandle(name); }
+
+    /**
+     * @brief Envía un sprite dinámico para el próximo renderWorld()
+     * @param handle Handle de textura resuelto con getSpriteHandle()
+     * @param worldX, worldY, worldZ Posición mundial (base del sprite)
+     *
+     * Capa de sprites dinámicos (jugador, NPCs, partículas): se ordenan entre
+     * sí y se intercalan con los tiles del terreno en su profundidad. Un sprite
+     * se dibuja después de los tiles con su misma clave de profundidad.
+     * La lista se vacía al terminar renderWorld().
+     */
+    void submitSprite(SpriteHandle handle, float worldX, float worldY, float worldZ) {
+        m_sprites.push(handle, worldX, worldY, worldZ);
+    }
 
     /**
      * @brief Renderiza el jugador
@@ -306,11 +347,46 @@ public:
      * @brief Dibuja el contador de FPS en la esquina de la pantalla
      * @param fps Valor de FPS a dibujar
      *
-     * Dibuja los FPS como texto segmentado en la esquina superior izquierda.
-     * Usa SDL_RenderDrawLine para dibujar dígitos de 7 segmentos.
+     * Dibuja los FPS en la esquina superior izquierda con drawDebugText.
      */
     void drawFPS(int fps);
 
+    /**
+     * @brief Dibuja texto de depuración multilínea sobre un fondo semitransparente
+     * @param text Texto (admite '\n')
+     * @param x, y Esquina superior izquierda del panel
+     *
+     * Usa el atlas de glifos cacheado: todo el panel es una sola llamada de dibujo.
+     */
+    void drawDebugText(const char* text, int x, int y);
+
+    /**
+     * @brief Dibuja el gráfico apilado de tiempos por etapa del profiler
+     * @param profiler Historial de frames a mostrar
+     * @param x, y Esquina superior izquierda del panel
+     *
+     * Una barra por frame del historial (el más reciente a la derecha) con
+     * una franja de color por etapa, líneas de referencia a 16.6 y 33.3 ms,
+     * percentiles p50/p95/p99 y los contadores del último frame.
+     * Todo el panel es una sola llamada de dibujo (atlas de glifos).
+     */
+    void drawProfiler(const Profiler& profiler, int x, int y);
+
+    /**
+     * @brief Dibuja una barra de progreso centrada con un texto encima
+     * @param fraction Progreso [0, 1]
+     * @param label Texto sobre la barra
+     *
+     * Para la pantalla de carga (el mundo todavía no se dibuja).
+     * Una sola llamada de dibujo (atlas de glifos).
+     */
+    void drawProgressBar(float fraction, const char* label);
+
+    /**
+     * @brief Cantidad de tiles del último renderWorld (diagnóstico)
+     */
+    size_t getLastTileCount() const { return m_tiles.size(); }
+
     /**
      * @brief Obtiene el renderer SDL2 subyacente
      * @return Puntero al renderer SDL2
@@ -337,19 +413,21 @@ private:
     SDL_Renderer* m_renderer;         ///< Renderer SDL2
     TextureManager m_textureManager;  ///< Gestor de texturas
     Uint8 m_clearR, m_clearG, m_clearB; ///< Color de fondo
-    std::vector<RenderTile> m_tileCache; ///< Cache reutilizable de tiles
+    TileList m_tiles;                 ///< Cache reutilizable de tiles (SoA)
+    TileDepthSorter m_depthSorter;    ///< Radix sort (clave, índice) con buffers persistentes
+    SpriteList m_sprites;             ///< Sprites dinámicos del frame (submitSprite)
+    TileDepthSorter m_spriteSorter;   ///< Sort de sprites (independiente del de terreno)
+    std::unique_ptr<TextRenderer> m_textRenderer;  ///< Texto de depuración (atlas de glifos)
 
     /**
-     * @brief Verifica si un chunk es visible en pantalla
-     * @param chunk Chunk a verificar
+     * @brief Dibuja un sprite dinámico de m_sprites
+     * @param spriteIndex Índice en m_sprites
      * @param camera Cámara para proyección
-     * @param screenWidth Ancho de pantalla
-     * @param screenHeight Alto de pantalla
-     * @return true si el chunk puede estar visible
      *
-     * Usa bounding box para descartar chunks completos antes de iterar bloques.
+     * Usa la textura y las dimensiones escaladas resueltas por handle,
+     * sin búsquedas por nombre ni SDL_QueryTexture.
      */
-    bool isChunkVisible(const Chunk* chunk, const Camera& camera, int screenWidth, int screenHeight);
+    void drawSprite(uint32_t spriteIndex, const Camera& camera);
 
     /**
      * @brief Crea lista de tiles para renderizar
@@ -372,14 +450,4 @@ private:
      * Los tiles con mayor depth se renderizan después (están "adelante").
      */
     void sortTilesByDepth(std::vector<RenderTile>& tiles);
-
-    /**
-     * @brief Radix Sort O(n) para tiles por profundidad isométrica
-     * @param tiles Vector de tiles a ordenar (se modifica in-place)
-     *
-     * OPTIMIZACIÓN FASE 2: Radix sort es O(n) vs O(n log n) de std::sort
-     * Aprovecha que las profundidades son enteros para sorting lineal.
-     * Usa 8-bit digits (4 pasadas) para ordenar por profundidad completa.
-     */
-    void radixSortTilesByDepth(std::vector<RenderTile>& tiles);
 };
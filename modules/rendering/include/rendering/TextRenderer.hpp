@@ -0,0 +1,120 @@
+/**
+ * @file TextRenderer.hpp
+ * @brief Texto de depuración con atlas de glifos cacheado
+ *
+ * Rasteriza una fuente bitmap 5x7 embebida en una textura UNA sola vez y
+ * dibuja el texto como quads texturizados acumulados en un único
+ * SDL_RenderGeometry por flush.
+ */
+
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class TextRenderer
+ * @brief Renderizador de texto por lotes sobre un atlas de glifos
+ *
+ * OPTIMIZACIÓN: Reemplaza los dígitos de 7 segmentos dibujados con
+ * SDL_RenderDrawLine (hasta 21 llamadas por dígito). Todo el texto y los
+ * fondos acumulados entre dos flush() cuestan una sola llamada de dibujo.
+ *
+ * Fuente:
+ * - Glifos de 5x7 píxeles (dígitos, A-Z y puntuación básica)
+ * - Las minúsculas se dibujan como mayúsculas
+ * - Caracteres sin glifo se dibujan como '?'
+ * - '\n' inicia una nueva línea
+ *
+ * Uso:
+ * @code
+ * text.addText("FPS: 60\nTILES: 1234", 10, 10, 2.0f, {255, 255, 0, 255});
+ * text.flush();  // 1 draw call
+ * @endcode
+ */
+class TextRenderer {
+public:
+    static constexpr int GLYPH_WIDTH = 5;    ///< Ancho del glifo (píxeles de fuente)
+    static constexpr int GLYPH_HEIGHT = 7;   ///< Alto del glifo (píxeles de fuente)
+    static constexpr int GLYPH_ADVANCE = 6;  ///< Avance horizontal por carácter
+    static constexpr int LINE_HEIGHT = 9;    ///< Avance vertical por línea
+
+    /**
+     * @brief Constructor
+     * @param renderer Renderer SDL2 donde se crea el atlas y se dibuja
+     */
+    explicit TextRenderer(SDL_Renderer* renderer);
+
+    /**
+     * @brief Destructor - libera la textura del atlas
+     */
+    ~TextRenderer();
+
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    /**
+     * @brief Rasteriza la fuente embebida en la textura del atlas
+     * @return true si el atlas se creó correctamente
+     */
+    bool init();
+
+    /**
+     * @brief Acumula los quads de un texto (no dibuja hasta flush())
+     * @param text Texto ASCII terminado en '\0' (admite '\n')
+     * @param x, y Esquina superior izquierda en pantalla
+     * @param scale Tamaño de un píxel de fuente en pantalla
+     * @param color Color del texto
+     */
+    void addText(const char* text, float x, float y, float scale, SDL_Color color);
+
+    /**
+     * @brief Acumula un rectángulo sólido (fondo de paneles de depuración)
+     * @param x, y, w, h Rectángulo en pantalla
+     * @param color Color (admite alpha)
+     */
+    void addRect(float x, float y, float w, float h, SDL_Color color);
+
+    /**
+     * @brief Calcula el tamaño en pantalla de un texto
+     * @param text Texto (admite '\n')
+     * @param scale Escala de la fuente
+     * @param width Ancho resultante (píxeles)
+     * @param height Alto resultante (píxeles)
+     */
+    static void measureText(const char* text, float scale, float& width, float& height);
+
+    /**
+     * @brief Dibuja todo lo acumulado con un único SDL_RenderGeometry
+     */
+    void flush();
+
+private:
+    static constexpr int ATLAS_COLUMNS = 16;          ///< Celdas por fila del atlas
+    static constexpr int ATLAS_ROWS = 4;              ///< Filas de celdas del atlas
+    static constexpr int CELL_WIDTH = GLYPH_WIDTH + 1;   ///< Celda con 1px de separación
+    static constexpr int CELL_HEIGHT = GLYPH_HEIGHT + 1; ///< Celda con 1px de separación
+    static constexpr int ATLAS_WIDTH = ATLAS_COLUMNS * CELL_WIDTH;
+    static constexpr int ATLAS_HEIGHT = ATLAS_ROWS * CELL_HEIGHT;
+
+    SDL_Renderer* m_renderer;             ///< Renderer SDL2
+    SDL_Texture* m_atlas = nullptr;       ///< Atlas de glifos (blanco sobre transparente)
+    std::array<int16_t, 128> m_glyphCell{};  ///< Celda del atlas por carácter ASCII (-1 = sin glifo)
+    int m_solidCell = -1;                 ///< Celda completamente opaca (para addRect)
+    int m_fallbackCell = -1;              ///< Celda del glifo '?'
+
+    // Buffers persistentes (sin allocations por frame)
+    std::vector<SDL_Vertex> m_vertices;   ///< Vértices acumulados
+    std::vector<int> m_indices;           ///< Índices acumulados (2 triángulos por quad)
+
+    /**
+     * @brief Agrega un quad texturizado
+     * @param x, y, w, h Rectángulo destino en pantalla
+     * @param srcX, srcY, srcW, srcH Rectángulo fuente en píxeles del atlas
+     * @param color Color por vértice
+     */
+    void addQuad(float x, float y, float w, float h,
+                 float srcX, float srcY, float srcW, float srcH, SDL_Color color);
+};
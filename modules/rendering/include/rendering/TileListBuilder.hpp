@@ -0,0 +1,91 @@
+/**
+ * @file TileListBuilder.hpp
+ * @brief Construcción de la lista de tiles visibles a partir de chunks e impostores
+ *
+ * Este archivo no depende de SDL: lo usan el Renderer y los benchmarks.
+ *
+ * Contiene la parte de CPU de renderWorld: culling de chunks por AABB en
+ * pantalla, selección de LOD por distancia, face culling y frustum culling
+ * por bloque. El resultado es una TileList lista para el depth sort.
+ */
+
+#pragma once
+
+#include "core/Chunk.hpp"
+#include "core/Camera.hpp"
+#include "rendering/RenderTiles.hpp"
+#include <array>
+#include <vector>
+
+/**
+ * @struct TileListStats
+ * @brief Contadores de una construcción de la lista (diagnóstico/profiler)
+ */
+struct TileListStats {
+    int solidBlocks = 0;   ///< Bloques sólidos recorridos
+    int culledBlocks = 0;  ///< Tiles descartados por frustum culling
+    int addedBlocks = 0;   ///< Tiles agregados a la lista
+    int drawnChunks = 0;   ///< Chunks que pasaron el culling por AABB
+};
+
+/**
+ * @class TileListBuilder
+ * @brief Genera la TileList de un frame
+ */
+class TileListBuilder {
+public:
+    static constexpr int MAX_TILE_SPRITE_SIZE = 64;  ///< Lado del sprite de tile más grande (árboles 64x64)
+
+    /**
+     * @brief Construye la lista de tiles visibles
+     * @param chunks Chunks completos candidatos (nullptr se ignora)
+     * @param impostors Impostores de horizonte (solo superficie)
+     * @param camera Cámara para proyección y distancia de LOD
+     * @param screenWidth Ancho de pantalla
+     * @param screenHeight Alto de pantalla
+     * @param tiles Lista de salida (se vacía conservando la capacidad)
+     * @param stats Contadores de salida (se sobrescriben)
+     */
+    static void build(const std::vector<Chunk*>& chunks,
+                      const std::vector<const ImpostorChunk*>& impostors,
+                      const Camera& camera, int screenWidth, int screenHeight,
+                      TileList& tiles, TileListStats& stats);
+
+    /**
+     * @brief Comprueba si el volumen de columnas de un chunk está en pantalla
+     * @param pos Posición del chunk
+     * @param minHeight Altura del bloque dibujado más bajo (no la superficie mínima)
+     * @param maxHeight Altura máxima del volumen
+     * @param camera Cámara para proyección
+     * @param screenWidth Ancho de pantalla
+     * @param screenHeight Alto de pantalla
+     * @return true si el AABB proyectado intersecta la pantalla
+     *
+     * Compartido por chunks completos e impostores de horizonte. El AABB se
+     * obtiene proyectando el volumen dibujado más el tamaño máximo de sprite,
+     * sin margen fijo. Un chunk completo dibuja caras expuestas por debajo de
+     * su superficie mínima (bordes, cuevas): el llamador pasa el piso del LOD
+     * (y=0 en LOD 0), no Chunk::getMinHeight(). Un impostor solo dibuja su
+     * superficie: ahí minHeight es el piso exacto.
+     */
+    static bool isColumnRangeVisible(ChunkPos pos, int minHeight, int maxHeight, const Camera& camera,
+                                     int screenWidth, int screenHeight);
+
+private:
+    /**
+     * @brief Agrega los tiles de superficie de un chunk lejano (LOD 2 o impostor)
+     * @param chunkPos Posición del chunk
+     * @param columns Superficie por columna (x + z*8)
+     * @param camera Cámara para proyección
+     * @param screenWidth Ancho de pantalla
+     * @param screenHeight Alto de pantalla
+     * @param tiles Lista de salida
+     * @param stats Contadores (addedBlocks y culledBlocks se incrementan)
+     *
+     * OPTIMIZACIÓN: LOD lejano por superficie. Emite un tile por columna
+     * (más el árbol si lo hay) desde la superficie cacheada, sin recorrer bloques.
+     */
+    static void addSurfaceTiles(ChunkPos chunkPos, const std::array<SurfaceColumn, 64>& columns,
+                                const Camera& camera, int screenWidth, int screenHeight,
+                                TileList& tiles, TileListStats& stats);
+};
@@ -6,10 +6,13 @@
  */
 
 #include "rendering/Renderer.hpp"
+#include "core/Profiler.hpp"
+#include "core/Trace.hpp"
 #include <iostream>
 #include <algorithm>
 #include <cmath>
 #include <array>
+#include <cstdio>
 
 // ============================================================================
 // TextureManager Implementation
@@ -139,6 +142,31 @@ SDL_Texture* TextureManager::getTexture(const std::string& name) const {
     return nullptr;
 }
 
+/**
+ * @brief Resuelve un handle de sprite dinámico por nombre
+ * @param name Nombre de la textura
+ * @return Handle estable (índice en m_spriteHandles) o INVALID_SPRITE
+ *
+ * Los punteros a valores de m_textures son estables (unordered_map no
+ * mueve nodos al crecer). Pedir el mismo nombre dos veces devuelve el mismo handle.
+ */
+SpriteHandle TextureManager::getSpriteHandle(const std::string& name) {
+    auto it = m_textures.find(name);
+    if (it == m_textures.end() || !it->second.texture) {
+        std::cerr << "Advertencia: Sprite '" << name << "' no encontrado" << std::endl;
+        return INVALID_SPRITE;
+    }
+
+    for (size_t i = 0; i < m_spriteHandles.size(); i++) {
+        if (m_spriteHandles[i] == &it->second) {
+            return static_cast<SpriteHandle>(i);
+        }
+    }
+
+    m_spriteHandles.push_back(&it->second);
+    return static_cast<SpriteHandle>(m_spriteHandles.size() - 1);
+}
+
 /**
  * @brief Carga todas las texturas del juego
  * @return true si todas se cargaron correctamente
@@ -193,11 +221,11 @@ bool TextureManager::loadAllTextures() {
         treeSpriteSheetInfo.scaledWidth = TREE_SPRITE_SIZE;
         treeSpriteSheetInfo.scaledHeight = TREE_SPRITE_SIZE;
         treeSpriteSheetInfoPtr = &treeSpriteSheetInfo;
-
-        // OPTIMIZACIÓN FASE 2: Pre-calcular sprite rects de árboles
-        initializeTreeSpriteCache();
     }
 
+    // OPTIMIZACIÓN: Pre-calcular la tabla de UVs (tipo, variante)
+    initializeSpriteRectTable();
+
     // Todos los bloques de terreno comparten el mismo TextureInfo del sprite sheet
     m_blockTextures[static_cast<int>(BlockType::PASTO)] = &spriteSheetInfo;
     m_blockTextures[static_cast<int>(BlockType::HIERBA_SANGRE)] = &spriteSheetInfo;
@@ -280,117 +308,47 @@ SDL_Rect TextureManager::getSpriteSheetRect(BlockType type) const {
 }
 
 /**
- * @brief Obtiene el rectángulo fuente para un árbol del sprite sheet de árboles
- * @param type Tipo de árbol (ARBOL_SECO, ARBOL_GRASS, ARBOL_SANGRE)
- * @param worldX Coordenada X mundial (para selección aleatoria)
- * @param worldZ Coordenada Z mundial (para selección aleatoria)
- * @return SDL_Rect con el área del sprite sheet correspondiente al árbol
+ * @brief Construye la tabla de UVs por (tipo, variante)
  *
- * OPTIMIZACIÓN FASE 2: Ahora usa cache pre-calculado en lugar de calcular
- * hash, módulo y división en cada frame. Solo calcula el índice del árbol
- * y hace lookup O(1) en el array cacheado.
+ * OPTIMIZACIÓN: Reemplaza el hash + módulo + switch que se hacía por cada
+ * árbol en cada frame. Los árboles se distribuyen en el sprite sheet de árboles:
+ * - Fila 1 (0-11): Árboles secos (ARBOL_SECO)
+ * - Filas 2-3 (12-35): Árboles vivos (ARBOL_GRASS)
+ * - Filas 4-5 (36-59): Árboles de sangre (ARBOL_SANGRE)
  *
- * Los árboles se distribuyen en:
- * - Fila 1 (0-11): Árboles secos para biomas secos (ARBOL_SECO)
- * - Filas 2-3 (12-35): Árboles vivos para biomas grass (ARBOL_GRASS)
- * - Filas 4-5 (36-59): Árboles de sangre para biomas blood_grass (ARBOL_SANGRE)
+ * Los bloques de terreno tienen una sola variante (su tile del sprite sheet).
+ * Las entradas sin sprite quedan vacías (w = h = 0).
  */
-SDL_Rect TextureManager::getTreeSpriteRect(BlockType type, int worldX, int worldZ) const {
-    // Si el cache no está inicializado, fallback al método original
-    if (!m_treeSpriteCache.initialized) {
-        SDL_Rect rect;
-        rect.w = TREE_SPRITE_SIZE;
-        rect.h = TREE_SPRITE_SIZE;
-
-        // Determinar el rango de índices según el tipo de árbol
-        int startIndex, endIndex;
-
-        switch (type) {
-            case BlockType::ARBOL_SECO:
-                startIndex = 0; endIndex = 11; break;
-            case BlockType::ARBOL_GRASS:
-                startIndex = 12; endIndex = 35; break;
-            case BlockType::ARBOL_SANGRE:
-                startIndex = 36; endIndex = 59; break;
-            default:
-                rect.x = 0; rect.y = 0; rect.w = 0; rect.h = 0;
-                return rect;
+void TextureManager::initializeSpriteRectTable() {
+    for (auto& variants : m_spriteRects) {
+        for (SDL_Rect& rect : variants) {
+            rect = SDL_Rect{0, 0, 0, 0};
         }
-
-        // Hash consistente para selección aleatoria
-        int treeCount = endIndex - startIndex + 1;
-        int hash = (worldX * 374761393 + worldZ * 668265263) % 1000000007;
-        int treeOffset = abs(hash) % treeCount;
-        int treeIndex = startIndex + treeOffset;
-
-        int column = treeIndex % TREE_SPRITE_COLUMNS;
-        int row = treeIndex / TREE_SPRITE_COLUMNS;
-        rect.x = column * TREE_SPRITE_SIZE;
-        rect.y = row * TREE_SPRITE_SIZE;
-        return rect;
     }
 
-    // OPTIMIZACIÓN: Usar cache pre-calculado (O(1) lookup)
-    int treeTypeIndex;
-    int startIndex, endIndex;
-
-    // Determinar tipo y rango de índices
-    switch (type) {
-        case BlockType::ARBOL_SECO:
-            treeTypeIndex = 0;
-            startIndex = 0; endIndex = 11;  // 12 árboles
-            break;
-        case BlockType::ARBOL_GRASS:
-            treeTypeIndex = 1;
-            startIndex = 12; endIndex = 35;  // 24 árboles
-            break;
-        case BlockType::ARBOL_SANGRE:
-            treeTypeIndex = 2;
-            startIndex = 36; endIndex = 59;  // 24 árboles
-            break;
-        default:
-            SDL_Rect empty{0, 0, 0, 0};
-            return empty;
+    // Terreno: variante 0 = tile del sprite sheet
+    for (int t = 0; t < static_cast<int>(BlockType::TOTAL_TIPOS); t++) {
+        m_spriteRects[t][0] = getSpriteSheetRect(static_cast<BlockType>(t));
     }
 
-    // Calcular índice específico del árbol (hash consistente)
-    int treeCount = endIndex - startIndex + 1;
-    int hash = (worldX * 374761393 + worldZ * 668265263) % 1000000007;
-    int treeOffset = abs(hash) % treeCount;
-    int treeIndex = startIndex + treeOffset;
-
-    // Lookup directo en cache (SIN calcular columna/fila)
-    return m_treeSpriteCache.rects[treeTypeIndex][treeIndex];
-}
+    // Árboles: una entrada por variante, a partir del primer sprite de su rango
+    const struct { BlockType type; int firstSprite; } treeRanges[] = {
+        {BlockType::ARBOL_SECO, 0},
+        {BlockType::ARBOL_GRASS, 12},
+        {BlockType::ARBOL_SANGRE, 36},
+    };
 
-/**
- * @brief Inicializa el cache de sprite rects de árboles
- *
- * Pre-calcula todos los rects posibles para cada tipo de árbol basado en spriteIndex.
- * Esto permite lookup O(1) en renderWorld() en lugar de calcular hash, módulo y división.
- */
-void TextureManager::initializeTreeSpriteCache() {
-    // Pre-calcular rects para cada tipo de árbol y cada sprite index (0-59)
-    for (int spriteIndex = 0; spriteIndex < TREE_SPRITE_COUNT; spriteIndex++) {
-        // Calcular posición en el sprite sheet
-        int column = spriteIndex % TREE_SPRITE_COLUMNS;
-        int row = spriteIndex / TREE_SPRITE_COLUMNS;
-
-        SDL_Rect rect;
-        rect.x = column * TREE_SPRITE_SIZE;
-        rect.y = row * TREE_SPRITE_SIZE;
-        rect.w = TREE_SPRITE_SIZE;
-        rect.h = TREE_SPRITE_SIZE;
-
-        // Almacenar el mismo rect para los 3 tipos de árbol
-        // La selección del tipo específico (ARBOL_SECO, ARBOL_GRASS, ARBOL_SANGRE)
-        // se basa en el rango de índices, no en el rect en sí
-        m_treeSpriteCache.rects[0][spriteIndex] = rect;  // ARBOL_SECO
-        m_treeSpriteCache.rects[1][spriteIndex] = rect;  // ARBOL_GRASS
-        m_treeSpriteCache.rects[2][spriteIndex] = rect;  // ARBOL_SANGRE
+    for (const auto& range : treeRanges) {
+        const int count = RenderVariants::getVariantCount(range.type);
+        for (int variant = 0; variant < count; variant++) {
+            int spriteIndex = range.firstSprite + variant;
+            SDL_Rect& rect = m_spriteRects[static_cast<int>(range.type)][variant];
+            rect.x = (spriteIndex % TREE_SPRITE_COLUMNS) * TREE_SPRITE_SIZE;
+            rect.y = (spriteIndex / TREE_SPRITE_COLUMNS) * TREE_SPRITE_SIZE;
+            rect.w = TREE_SPRITE_SIZE;
+            rect.h = TREE_SPRITE_SIZE;
+        }
     }
-
-    m_treeSpriteCache.initialized = true;
 }
 
 // ============================================================================
@@ -413,7 +371,7 @@ Renderer::Renderer(SDL_Window* window)
     , m_clearB(235)  // Sky blue
 {
     // Pre-asignar cache de tiles (capacidad para ~200k tiles)
-    m_tileCache.reserve(200000);
+    m_tiles.reserve(200000);
 
     // Crear renderer con aceleración hardware SIN VSync (para FPS ilimitados)
     m_renderer = SDL_CreateRenderer(
@@ -434,12 +392,21 @@ Renderer::Renderer(SDL_Window* window)
     if (!m_textureManager.loadAllTextures()) {
         std::cerr << "Advertencia: Algunas texturas no pudieron cargarse" << std::endl;
     }
+
+    // Rasterizar el atlas de glifos del texto de depuración (una sola vez)
+    m_textRenderer = std::make_unique<TextRenderer>(m_renderer);
+    if (!m_textRenderer->init()) {
+        m_textRenderer.reset();
+    }
 }
 
 /**
  * @brief Destructor - libera renderer SDL2
  */
 Renderer::~Renderer() {
+    // El atlas de texto debe liberarse antes que el renderer que lo creó
+    m_textRenderer.reset();
+
     if (m_renderer) {
         SDL_DestroyRenderer(m_renderer);
     }
@@ -457,6 +424,8 @@ void Renderer::clear() {
  * @brief Presenta el renderizado (flip buffer)
  */
 void Renderer::present() {
+    PROFILE_SCOPE(PRESENT);
+    TRACE_SCOPE("present");
     SDL_RenderPresent(m_renderer);
 }
 
@@ -601,64 +570,6 @@ void Renderer::sortTilesByDepth(std::vector<RenderTile>& tiles) {
     });
 }
 
-/**
- * @brief Radix Sort O(n) para tiles por profundidad isométrica
- * @param tiles Vector de tiles (se modifica in-place)
- *
- * OPTIMIZACIÓN FASE 2: Implementación LSD radix sort para 32-bit integers.
- * Procesa 8 bits a la vez (4 pasadas para 32 bits).
- * Maneja signed integers invirtiendo el bit de signo.
- *
- * Complejidad: O(n) vs O(n log n) de std::sort
- * Memoria: O(n) para buffer temporal
- */
-void Renderer::radixSortTilesByDepth(std::vector<RenderTile>& tiles) {
-    if (tiles.size() <= 1) return;
-
-    // Buffer temporal para swapping
-    std::vector<RenderTile> temp(tiles.size());
-
-    // 4 pasadas de 8 bits cada una (32 bits total)
-    for (int shift = 0; shift < 32; shift += 8) {
-        // Inicializar buckets para 256 valores posibles (8 bits)
-        size_t count[256] = {0};
-
-        // Contar frecuencia de cada valor de bucket
-        for (size_t i = 0; i < tiles.size(); i++) {
-            // Calcular profundidad como entero
-            int depth = tiles[i].worldX + tiles[i].worldZ + tiles[i].worldY * 2;
-
-            // XOR con bit de signo para manejar signed integers correctamente
-            // Esto convierte -1 a 0x7FFFFFFF, manteniendo orden correcto
-            uint32_t signedDepth = static_cast<uint32_t>(depth) ^ 0x80000000;
-
-            // Extraer 8 bits actuales
-            int bucket = (signedDepth >> shift) & 0xFF;
-            count[bucket]++;
-        }
-
-        // Convertir conteos a posiciones acumuladas
-        size_t total = 0;
-        for (int i = 0; i < 256; i++) {
-            size_t oldCount = count[i];
-            count[i] = total;
-            total += oldCount;
-        }
-
-        // Distribuir elementos en buffer temporal
-        for (size_t i = 0; i < tiles.size(); i++) {
-            int depth = tiles[i].worldX + tiles[i].worldZ + tiles[i].worldY * 2;
-            uint32_t signedDepth = static_cast<uint32_t>(depth) ^ 0x80000000;
-            int bucket = (signedDepth >> shift) & 0xFF;
-
-            temp[count[bucket]++] = tiles[i];
-        }
-
-        // Swap arrays para siguiente pasada
-        std::swap(tiles, temp);
-    }
-}
-
 /**
  * @brief Renderiza el mundo completo con optimizaciones
  * @param chunks Vector de chunks visibles
@@ -675,249 +586,44 @@ void Renderer::radixSortTilesByDepth(std::vector<RenderTile>& tiles) {
  * - Frustum culling con margen 100px
  * - Sort por Y (más simple que screenX+screenY)
  */
-bool Renderer::isChunkVisible(const Chunk* chunk, const Camera& camera, int screenWidth, int screenHeight) {
-    ChunkPos pos = chunk->getPosition();
-
-    // OPTIMIZACIÓN FASE 2: Proyectar solo el centro del chunk + radio aproximado
-    // OPTIMIZACIÓN FASE 2: centerY ajustado para WORLD_HEIGHT=32 (promedio de 3-28)
-    float centerX = pos.x * BlockConfig::CHUNK_SIZE + BlockConfig::CHUNK_SIZE * 0.5f;
-    float centerZ = pos.z * BlockConfig::CHUNK_SIZE + BlockConfig::CHUNK_SIZE * 0.5f;
-    float centerY = 15.5f;  // Altura promedio del terreno (mitad de 3-28)
-
-    // Proyectar solo el centro del chunk (1 proyección en lugar de 8)
-    float screenX, screenY;
-    camera.worldToScreen(centerX, centerY, centerZ, screenX, screenY);
-
-    // Radio aproximado en pantalla (chunk_size × tile_size × zoom / 2)
-    // Estimación conservadora para chunk de 8×8 en altura máxima
-    float zoom = camera.getZoom();
-    const float approximateRadius = BlockConfig::CHUNK_SIZE * 64.0f * zoom;  // 64 = TILE_WIDTH + TILE_HEIGHT aprox
-
-    const int margin = 100;
-    return !(screenX + approximateRadius < -margin ||
-             screenX - approximateRadius > screenWidth + margin ||
-             screenY + approximateRadius < -margin ||
-             screenY - approximateRadius > screenHeight + margin);
-}
-
-void Renderer::renderWorld(const std::vector<Chunk*>& chunks, const Camera& camera,
-                           float playerX, float playerY, float playerZ) {
-    // OPTIMIZACIÓN: Usar resize(0) en lugar de clear() para mantener capacidad sin reallocation
-    m_tileCache.resize(0);
+void Renderer::renderWorld(const std::vector<Chunk*>& chunks,
+                           const std::vector<const ImpostorChunk*>& impostors, const Camera& camera) {
+    TRACE_SCOPE("Renderer::renderWorld");
+    PROFILE_BEGIN(BUILD_LIST);
 
     // Obtener tamaño de pantalla UNA vez (no en el loop)
     int screenWidth, screenHeight;
     SDL_GetRendererOutputSize(m_renderer, &screenWidth, &screenHeight);
 
-    int solidBlocks = 0;
-    int culledBlocks = 0;
-    int addedBlocks = 0;
+    // Lista de tiles visibles (culling, LOD, face culling) sin dependencias de SDL
+    TileListStats stats;
+    TileListBuilder::build(chunks, impostors, camera, screenWidth, screenHeight, m_tiles, stats);
 
-    // Obtener posición del jugador para cálculos de distancia LOD
-    float camX, camY, camZ;
-    camera.getPosition(camX, camY, camZ);
+    PROFILE_END(BUILD_LIST);
+    PROFILE_COUNTER(SOLID_BLOCKS, stats.solidBlocks);
+    PROFILE_COUNTER(CULLED_BLOCKS, stats.culledBlocks);
+    PROFILE_COUNTER(ADDED_BLOCKS, stats.addedBlocks);
+    PROFILE_COUNTER(CHUNKS_DRAWN, stats.drawnChunks);
+    TRACE_COUNTER("tiles", m_tiles.size());
 
-    for (const Chunk* chunk : chunks) {
-        if (!chunk) continue;
-
-        // Bounding box culling - descartar chunk completo si está fuera de pantalla
-        if (!isChunkVisible(chunk, camera, screenWidth, screenHeight)) {
-            continue;
-        }
-
-        ChunkPos chunkPos = chunk->getPosition();
-        int worldXStart = chunkPos.x * BlockConfig::CHUNK_SIZE;
-        int worldZStart = chunkPos.z * BlockConfig::CHUNK_SIZE;
-
-        // OPTIMIZACIÓN 9: LOD SYSTEM - Calcular distancia del chunk al jugador
-        // QUICK WIN #1: AGGRESSIVE LOD - Thresholds reducidos para más culling agresivo
-        float chunkCenterX = worldXStart + BlockConfig::CHUNK_SIZE * 0.5f;
-        float chunkCenterZ = worldZStart + BlockConfig::CHUNK_SIZE * 0.5f;
-        float distX = chunkCenterX - camX;
-        float distZ = chunkCenterZ - camZ;
-        float distanceSquared = distX * distX + distZ * distZ;
-
-        // Determinar nivel de detalle según distancia (AGGRESSIVE LOD)
-        // LOD 0: 0-6 chunks (completo) - reducido de 8
-        // LOD 1: 6-10 chunks (medio) - reducido de 8-16
-        // LOD 2: 10+ chunks (mínimo) - reducido de 16
-        int lodLevel = 0;
-        const float lod1Distance = BlockConfig::CHUNK_SIZE * 6.0f;  // ~48 bloques (reducido de 64)
-        const float lod2Distance = BlockConfig::CHUNK_SIZE * 10.0f; // ~80 bloques (reducido de 128)
-
-        if (distanceSquared > lod2Distance * lod2Distance) {
-            lodLevel = 2;  // Muy lejos - mínimo detalle
-        } else if (distanceSquared > lod1Distance * lod1Distance) {
-            lodLevel = 1;  // Medio lejos - detalle medio
-        }
-        // lodLevel 0: Cerca - detalle completo
-
-        // Recorrer todos los bloques del chunk (OCCLUSION CULLING con heightmap)
-        for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
-            for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
-                // OPTIMIZACIÓN: Solo iterar hasta la altura máxima de esta columna
-                int maxY = chunk->getMaxY(x, z);
-
-                for (int y = 0; y <= maxY; y++) {
-                    const Block& block = chunk->getBlockUnsafe(x, y, z);
-
-                    // Solo renderizar bloques sólidos
-                    if (!block.esSolido()) {
-                        continue;
-                    }
-
-                    solidBlocks++;
-
-                    // OPTIMIZACIÓN 9: LOD - Skip bloques underground según nivel de detalle
-                    if (lodLevel >= 2) {
-                        // LOD 2: Solo renderizar bloques superficiales (últimos 5 de la columna)
-                        int surfaceY = maxY;
-                        if (y < surfaceY - 5) {
-                            continue;  // Skip bloques profundos
-                        }
-                    } else if (lodLevel == 1) {
-                        // LOD 1: Solo renderizar bloques superficiales (últimos 15 de la columna)
-                        int surfaceY = maxY;
-                        if (y < surfaceY - 15) {
-                            continue;  // Skip bloques profundos
-                        }
-                    }
-                    // lodLevel 0: Renderizar todos los bloques (completo)
-
-                    // OPTIMIZACIÓN 7: FACE CULLING - No renderizar bloques completamente ocultos
-                    // Un bloque es visible si AL MENOS UNA de sus 6 caras está expuesta (tiene vecino aire)
-                    // En LOD 1 y 2, skip face culling para mejorar rendimiento
-                    bool hasExposedFace = true;  // Default para LOD >= 1
-
-                    if (lodLevel == 0) {
-                        // LOD 0: Face culling completo
-                        hasExposedFace = false;
-
-                        // Verificar cara SUPERIOR (y+1) - la más importante en isométrico
-                        if (y < BlockConfig::WORLD_HEIGHT - 1) {
-                            const Block& above = chunk->getBlockUnsafe(x, y + 1, z);
-                            // Si el bloque encima es un árbol, consideramos que la cara superior está expuesta
-                            // (queremos ver el grass debajo del árbol)
-                            bool isAboveTree = (above.type == BlockType::ARBOL_SECO ||
-                                              above.type == BlockType::ARBOL_GRASS ||
-                                              above.type == BlockType::ARBOL_SANGRE);
-                            if (!above.esSolido() || isAboveTree) {
-                                hasExposedFace = true;
-                            }
-                        } else {
-                            hasExposedFace = true;  // Borde superior del mundo
-                        }
-
-                        // Verificar caras LATERALES si la superior no está expuesta
-                        if (!hasExposedFace) {
-                            // Cara X+ (este)
-                            if (x < BlockConfig::CHUNK_SIZE - 1) {
-                                const Block& east = chunk->getBlockUnsafe(x + 1, y, z);
-                                if (!east.esSolido()) hasExposedFace = true;
-                            } else {
-                                hasExposedFace = true;  // Borde del chunk
-                            }
-
-                            // Cara X- (oeste)
-                            if (!hasExposedFace && x > 0) {
-                                const Block& west = chunk->getBlockUnsafe(x - 1, y, z);
-                                if (!west.esSolido()) hasExposedFace = true;
-                            } else if (!hasExposedFace && x == 0) {
-                                hasExposedFace = true;  // Borde del chunk
-                            }
-
-                            // Cara Z+ (sur)
-                            if (!hasExposedFace && z < BlockConfig::CHUNK_SIZE - 1) {
-                                const Block& south = chunk->getBlockUnsafe(x, y, z + 1);
-                                if (!south.esSolido()) hasExposedFace = true;
-                            } else if (!hasExposedFace && z == BlockConfig::CHUNK_SIZE - 1) {
-                                hasExposedFace = true;  // Borde del chunk
-                            }
-
-                            // Cara Z- (norte)
-                            if (!hasExposedFace && z > 0) {
-                                const Block& north = chunk->getBlockUnsafe(x, y, z - 1);
-                                if (!north.esSolido()) hasExposedFace = true;
-                            } else if (!hasExposedFace && z == 0) {
-                                hasExposedFace = true;  // Borde del chunk
-                            }
-                        }
-                    }
-
-                    // QUICK WIN #3: Per-Block Frustum Culling optimizado según LOD
-                    float worldX = static_cast<float>(worldXStart + x);
-                    float worldZ = static_cast<float>(worldZStart + z);
-                    float screenX, screenY;
-                    camera.worldToScreen(worldX, static_cast<float>(y), worldZ, screenX, screenY);
-
-                    // Para LOD 2 (muy lejos), hacer culling más agresivo sin face checking previo
-                    if (lodLevel >= 2) {
-                        // Frustum culling agresivo para LOD 2 (menos margen)
-                        const int margin = 20;  // Solo 20px margen para bloques lejanos
-                        if (screenX < -margin || screenX > screenWidth + margin ||
-                            screenY < -margin || screenY > screenHeight + margin) {
-                            culledBlocks++;
-                            continue;  // Fuera de pantalla
-                        }
-                    } else {
-                        // Para LOD 0 y 1, hacer face culling primero (más preciso pero más costoso)
-                        if (!hasExposedFace) {
-                            continue;  // Skip - occlusion culling
-                        }
-
-                        // Frustum culling normal para chunks cercanos
-                        const int margin = 100;  // Margen generoso para bloques cercanos
-                        if (screenX < -margin || screenX > screenWidth + margin ||
-                            screenY < -margin || screenY > screenHeight + margin) {
-                            culledBlocks++;
-                            continue;  // Fuera de pantalla
-                        }
-                    }
-
-                    // Agregar a la lista
-                    RenderTile tile;
-                    tile.x = screenX;
-                    tile.y = screenY;
-                    tile.type = block.type;
-                    tile.worldY = y;
-                    tile.worldX = worldXStart + x;
-                    tile.worldZ = worldZStart + z;
-
-                    m_tileCache.push_back(tile);
-                    addedBlocks++;
-                }
-            }
-        }
-    }
+    PROFILE_BEGIN(SORT);
 
     // OPTIMIZACIÓN FASE 2: Radix Sort O(n) en lugar de std::sort O(n log n)
     // Ordenar por profundidad isométrica correcta (back-to-front)
     // Fórmula: depth = X + Z + Y*2 (Y tiene doble peso en isométrico)
+    //
+    // OPTIMIZACIÓN: Ordenar el terreno por profundidad con radix sort de pares
+    // (clave, índice). Solo se mueven enteros de 32/64 bits, no structs.
+    // El sort es estable: los empates conservan el orden de inserción.
+    const std::vector<uint32_t>& drawOrder = m_depthSorter.sort(m_tiles.depth.data(), m_tiles.size());
 
-    // INTEGRAR JUGADOR AL DEPTH SORTING
-    // Convertir posición del jugador a coordenadas de pantalla
-    float playerScreenX, playerScreenY;
-    camera.worldToScreen(playerX, playerY, playerZ, playerScreenX, playerScreenY);
-
-    // Crear un RenderTile especial para el jugador
-    RenderTile playerTile;
-    playerTile.x = playerScreenX;
-    playerTile.y = playerScreenY;
-    playerTile.type = BlockType::AIRE; // No usamos type para el jugador
-    playerTile.worldY = static_cast<int>(playerY);
-    playerTile.worldX = static_cast<int>(playerX);
-    playerTile.worldZ = static_cast<int>(playerZ);
-    playerTile.isPlayer = true; // Marcar como jugador
-
-    // Agregar al cache para que el Radix Sort lo ordene con los tiles/árboles
-    m_tileCache.push_back(playerTile);
-
-    // Ordenar TODO (tiles + jugador) por profundidad
-    radixSortTilesByDepth(m_tileCache);
+    // CAPA DE SPRITES DINÁMICOS: se ordenan solo entre sí (pocos elementos)
+    // y se intercalan con el terreno ya ordenado al dibujar
+    const std::vector<uint32_t>& spriteOrder = m_spriteSorter.sort(m_sprites.depth.data(), m_sprites.size());
 
-    // NOTA: Radix sort es estable para claves únicas, pero si hay empates
-    // usamos un criterio secundario de desempate. Como radix sort ya está
-    // implementado para la profundidad completa, los empates son raros.
+    PROFILE_END(SORT);
+    PROFILE_SCOPE(SUBMIT);
+    TRACE_SCOPE("submit");
 
     // OPTIMIZACIÓN 1: Pre-calcular dimensiones escaladas UNA vez por frame
     float zoom = camera.getZoom();
@@ -927,38 +633,34 @@ void Renderer::renderWorld(const std::vector<Chunk*>& chunks, const Camera& came
     // Iterar en orden de profundidad y hacer batch de tiles contiguos del mismo tipo
     BlockType currentType = BlockType::AIRE;
     TextureManager::TextureInfo* currentTexInfo = nullptr;
-    SDL_Rect currentSrcRect{};
     int currentScaledWidth = 0;
     int currentScaledHeight = 0;
     bool textureValid = false;
 
-    for (const RenderTile& tile : m_tileCache) {
-        // VERIFICAR SI ES EL JUGADOR
-        if (tile.isPlayer) {
-            // Renderizar jugador con su textura especial
-            SDL_Texture* playerTexture = m_textureManager.getTexture("player");
-            if (playerTexture) {
-                int texWidth, texHeight;
-                SDL_QueryTexture(playerTexture, nullptr, nullptr, &texWidth, &texHeight);
-
-                // Aplicar zoom
-                texWidth = static_cast<int>(texWidth * zoom);
-                texHeight = static_cast<int>(texHeight * zoom);
-
-                SDL_Rect destRect;
-                destRect.x = static_cast<int>(std::round(tile.x - texWidth / 2.0f));
-                destRect.y = static_cast<int>(std::round(tile.y - texHeight));
-                destRect.w = texWidth;
-                destRect.h = texHeight;
-
-                SDL_RenderCopy(m_renderer, playerTexture, nullptr, &destRect);
-            }
-            continue; // Saltar al siguiente tile
+    // MERGE: recorrer terreno y sprites ordenados a la vez. Un sprite se dibuja
+    // después de los tiles con su misma clave (equivale al sort estable con el
+    // sprite insertado al final).
+    const size_t tileCount = drawOrder.size();
+    const size_t spriteCount = spriteOrder.size();
+    size_t nextTile = 0;
+    size_t nextSprite = 0;
+
+    while (nextTile < tileCount || nextSprite < spriteCount) {
+        if (nextSprite < spriteCount &&
+            (nextTile == tileCount ||
+             m_sprites.depth[spriteOrder[nextSprite]] < m_tiles.depth[drawOrder[nextTile]])) {
+            drawSprite(spriteOrder[nextSprite++], camera);
+            continue;
         }
 
+        const uint32_t index = drawOrder[nextTile++];
+        const float tileX = m_tiles.x[index];
+        const float tileY = m_tiles.y[index];
+
         // Si el tipo cambió, necesitamos obtener nueva info de textura
-        if (tile.type != currentType) {
-            currentType = tile.type;
+        const BlockType tileType = m_tiles.type[index];
+        if (tileType != currentType) {
+            currentType = tileType;
             currentTexInfo = m_textureManager.getBlockTexture(currentType);
             textureValid = false;
 
@@ -971,35 +673,48 @@ void Renderer::renderWorld(const std::vector<Chunk*>& chunks, const Camera& came
 
         // Renderizar si la textura es válida
         if (textureValid) {
-            // Verificar si es un árbol para obtener el sprite correcto
-            bool isTree = (currentType == BlockType::ARBOL_SECO ||
-                          currentType == BlockType::ARBOL_GRASS ||
-                          currentType == BlockType::ARBOL_SANGRE);
-
-            // Obtener el rectángulo fuente (diferente para cada árbol)
-            if (isTree) {
-                // Cada árbol tiene su propio sprite basado en posición
-                currentSrcRect = m_textureManager.getTreeSpriteRect(currentType, tile.worldX, tile.worldZ);
-            } else {
-                // Los bloques normales comparten el mismo sprite
-                currentSrcRect = m_textureManager.getSpriteSheetRect(currentType);
-            }
+            // OPTIMIZACIÓN: Lookup directo en la tabla de UVs por (tipo, variante).
+            // La variante de los árboles se eligió al generar el chunk.
+            const SDL_Rect& srcRect = m_textureManager.getSpriteRect(currentType, m_tiles.variant[index]);
 
             // Si el sprite no es válido, skip
-            if (currentSrcRect.w == 0 || currentSrcRect.h == 0) {
+            if (srcRect.w == 0 || srcRect.h == 0) {
                 continue;
             }
 
             SDL_Rect destRect;
             // Centrar el bloque/árbol en la posición
-            destRect.x = static_cast<int>(tile.x - currentScaledWidth / 2.0f + 0.5f);
-            destRect.y = static_cast<int>(tile.y - currentScaledHeight + 0.5f);
+            destRect.x = static_cast<int>(tileX - currentScaledWidth / 2.0f + 0.5f);
+            destRect.y = static_cast<int>(tileY - currentScaledHeight + 0.5f);
             destRect.w = currentScaledWidth;
             destRect.h = currentScaledHeight;
 
-            SDL_RenderCopy(m_renderer, currentTexInfo->texture, &currentSrcRect, &destRect);
+            SDL_RenderCopy(m_renderer, currentTexInfo->texture, &srcRect, &destRect);
         }
     }
+
+    // Los sprites se envían de nuevo cada frame
+    m_sprites.clear();
+}
+
+void Renderer::drawSprite(uint32_t spriteIndex, const Camera& camera) {
+    const TextureManager::TextureInfo* info = m_textureManager.getSpriteInfo(m_sprites.handle[spriteIndex]);
+    if (!info) {
+        return;
+    }
+
+    float screenX, screenY;
+    camera.worldToScreen(m_sprites.worldX[spriteIndex], m_sprites.worldY[spriteIndex],
+                         m_sprites.worldZ[spriteIndex], screenX, screenY);
+
+    // Dimensiones escaladas ya cacheadas por updateScaledDimensions (sin SDL_QueryTexture)
+    SDL_Rect destRect;
+    destRect.x = static_cast<int>(std::round(screenX - info->scaledWidth / 2.0f));
+    destRect.y = static_cast<int>(std::round(screenY - info->scaledHeight));
+    destRect.w = info->scaledWidth;
+    destRect.h = info->scaledHeight;
+
+    SDL_RenderCopy(m_renderer, info->texture, nullptr, &destRect);
 }
 
 /**
@@ -1053,84 +768,177 @@ void Renderer::setClearColor(Uint8 r, Uint8 g, Uint8 b) {
 }
 
 /**
- * @brief Dibuja un dígito de 7 segmentos
- * @param x, y Posición del dígito
- * @param digit Dígito a dibujar (0-9)
- * @param scale Escala del dígito
- * @param color Color RGB para el dígito
+ * @brief Dibuja un bloque de texto de depuración con fondo
+ * @param text Texto (admite '\n')
+ * @param x, y Esquina superior izquierda del panel
+ *
+ * OPTIMIZACIÓN: Fondo + todos los glifos = 1 SDL_RenderGeometry.
  */
-static void drawDigit(SDL_Renderer* renderer, int x, int y, int digit, int scale, Uint8 color[3]) {
-    // Patrones de 7 segmentos (A=top, B=top-right, C=bottom-right, D=bottom, E=bottom-left, F=top-left, G=middle)
-    static const bool segments[10][7] = {
-        {1, 1, 1, 1, 1, 1, 0}, // 0: ABCDEF
-        {0, 1, 1, 0, 0, 0, 0}, // 1: BC
-        {1, 1, 0, 1, 1, 0, 1}, // 2: ABDEG
-        {1, 1, 1, 1, 0, 0, 1}, // 3: ABCDG
-        {0, 1, 1, 0, 0, 1, 1}, // 4: BCFG
-        {1, 0, 1, 1, 0, 1, 1}, // 5: ACDFG
-        {1, 0, 1, 1, 1, 1, 1}, // 6: ACDEFG
-        {1, 1, 1, 0, 0, 0, 0}, // 7: ABC
-        {1, 1, 1, 1, 1, 1, 1}, // 8: ABCDEFG
-        {1, 1, 1, 1, 0, 1, 1}  // 9: ABCDFG
-    };
-
-    if (digit < 0 || digit > 9) return;
+void Renderer::drawDebugText(const char* text, int x, int y) {
+    if (!m_textRenderer) {
+        return;
+    }
 
-    const bool* seg = segments[digit];
-    int w = scale * 3;  // ancho total del dígito
-    int h = scale * 5;  // alto total del dígito
-    int thick = scale / 2;  // grosor de las líneas (más grueso)
+    const float scale = 2.0f;
+    const float padding = 6.0f;
+    float textW = 0.0f;
+    float textH = 0.0f;
+    TextRenderer::measureText(text, scale, textW, textH);
 
-    SDL_SetRenderDrawColor(renderer, color[0], color[1], color[2], 255);
+    m_textRenderer->addRect(static_cast<float>(x), static_cast<float>(y),
+                            textW + padding * 2, textH + padding * 2, {0, 0, 0, 160});
+    m_textRenderer->addText(text, x + padding, y + padding, scale, {255, 255, 0, 255});  // Amarillo brillante
+    m_textRenderer->flush();
+}
 
-    // Segmento A (top horizontal)
-    if (seg[0]) {
-        SDL_RenderDrawLine(renderer, x, y, x + w, y);
-        SDL_RenderDrawLine(renderer, x, y + 1, x + w, y + 1);  // Más grueso
-        SDL_RenderDrawLine(renderer, x, y + 2, x + w, y + 2);
+/**
+ * @brief Dibuja el gráfico apilado de tiempos por etapa del profiler
+ * @param profiler Historial de frames
+ * @param x, y Esquina superior izquierda del panel
+ */
+void Renderer::drawProfiler(const Profiler& profiler, int x, int y) {
+    if (!m_textRenderer) {
+        return;
     }
 
-    // Segmento B (top-right vertical)
-    if (seg[1]) {
-        SDL_RenderDrawLine(renderer, x + w, y, x + w, y + h / 2);
-        SDL_RenderDrawLine(renderer, x + w - 1, y, x + w - 1, y + h / 2);
-        SDL_RenderDrawLine(renderer, x + w - 2, y, x + w - 2, y + h / 2);
-    }
+    // Un color por etapa (mismo orden que ProfileStage)
+    static const SDL_Color STAGE_COLORS[PROFILE_STAGE_COUNT] = {
+        {80, 160, 255, 255},   // INPUT
+        {0, 200, 200, 255},    // PLAYER_UPDATE
+        {255, 140, 0, 255},    // UPDATE_CHUNKS
+        {255, 220, 0, 255},    // GET_CHUNKS
+        {0, 200, 80, 255},     // BUILD_LIST
+        {220, 60, 220, 255},   // SORT
+        {230, 60, 60, 255},    // SUBMIT
+        {170, 170, 255, 255},  // PRESENT
+    };
+    const SDL_Color otherColor = {110, 110, 110, 255};  // Tiempo fuera de las etapas medidas
+
+    const float padding = 6.0f;
+    const float textScale = 2.0f;
+    const float barWidth = 2.0f;
+    const float graphWidth = Profiler::HISTORY_SIZE * barWidth;
+    const float graphHeight = 120.0f;
+    const float maxMs = 33.3f;  // Tope del gráfico (30 FPS)
+    const float pixelsPerMs = graphHeight / maxMs;
+
+    // Texto: percentiles, una línea por etapa y contadores del último frame
+    float p50, p95, p99;
+    profiler.getFrameTimePercentiles(p50, p95, p99);
+
+    // snprintf devuelve lo que habría escrito: si no entra, el texto queda
+    // truncado y se deja de agregar (length nunca pasa del buffer)
+    char text[512];
+    size_t length = 0;
+    auto advance = [&](int written) {
+        if (written < 0 || static_cast<size_t>(written) >= sizeof(text) - length) {
+            if (written < 0) {
+                text[length] = '\0';
+            }
+            length = sizeof(text) - 1;
+            return false;
+        }
+        length += static_cast<size_t>(written);
+        return true;
+    };
 
-    // Segmento C (bottom-right vertical)
-    if (seg[2]) {
-        SDL_RenderDrawLine(renderer, x + w, y + h / 2, x + w, y + h);
-        SDL_RenderDrawLine(renderer, x + w - 1, y + h / 2, x + w - 1, y + h);
-        SDL_RenderDrawLine(renderer, x + w - 2, y + h / 2, x + w - 2, y + h);
+    bool fits = advance(std::snprintf(text, sizeof(text), "P50 %.2f  P95 %.2f  P99 %.2f MS\n", p50, p95, p99));
+    for (size_t stage = 0; stage < PROFILE_STAGE_COUNT && fits; stage++) {
+        const ProfileStage s = static_cast<ProfileStage>(stage);
+        fits = advance(std::snprintf(text + length, sizeof(text) - length, "%-13s %6.2f MS\n",
+                                     Profiler::getStageName(s), profiler.getStageAverage(s)));
+    }
+    if (profiler.getFrameCount() > 0) {
+        const ProfileFrame& last = profiler.getFrame(0);
+        for (size_t counter = 0; counter < PROFILE_COUNTER_COUNT && fits; counter++) {
+            fits = advance(std::snprintf(text + length, sizeof(text) - length, "%s %d  ",
+                                         Profiler::getCounterName(static_cast<ProfileCounter>(counter)),
+                                         last.counters[counter]));
+        }
     }
 
-    // Segmento D (bottom horizontal)
-    if (seg[3]) {
-        SDL_RenderDrawLine(renderer, x, y + h, x + w, y + h);
-        SDL_RenderDrawLine(renderer, x, y + h - 1, x + w, y + h - 1);
-        SDL_RenderDrawLine(renderer, x, y + h - 2, x + w, y + h - 2);
-    }
+    float textW = 0.0f;
+    float textH = 0.0f;
+    TextRenderer::measureText(text, textScale, textW, textH);
+    const float legendIndent = 8.0f * textScale;  // Espacio para el cuadro de color
+
+    const float panelX = static_cast<float>(x);
+    const float panelY = static_cast<float>(y);
+    const float panelW = std::max(graphWidth, legendIndent + textW) + padding * 2;
+    const float panelH = graphHeight + textH + padding * 3;
+    m_textRenderer->addRect(panelX, panelY, panelW, panelH, {0, 0, 0, 160});
+
+    // Barras apiladas: el frame más reciente a la derecha
+    const float graphX = panelX + padding;
+    const float graphBottom = panelY + padding + graphHeight;
+    for (size_t age = 0; age < profiler.getFrameCount(); age++) {
+        const ProfileFrame& frame = profiler.getFrame(age);
+        const float barX = graphX + graphWidth - (age + 1) * barWidth;
+        float stackMs = 0.0f;
+
+        for (size_t stage = 0; stage < PROFILE_STAGE_COUNT && stackMs < maxMs; stage++) {
+            const float ms = std::min(frame.stageMs[stage], maxMs - stackMs);
+            if (ms > 0.0f) {
+                m_textRenderer->addRect(barX, graphBottom - (stackMs + ms) * pixelsPerMs,
+                                        barWidth, ms * pixelsPerMs, STAGE_COLORS[stage]);
+                stackMs += ms;
+            }
+        }
 
-    // Segmento E (bottom-left vertical)
-    if (seg[4]) {
-        SDL_RenderDrawLine(renderer, x, y + h / 2, x, y + h);
-        SDL_RenderDrawLine(renderer, x + 1, y + h / 2, x + 1, y + h);
-        SDL_RenderDrawLine(renderer, x + 2, y + h / 2, x + 2, y + h);
+        const float otherMs = std::min(frame.totalMs, maxMs) - stackMs;
+        if (otherMs > 0.0f) {
+            m_textRenderer->addRect(barX, graphBottom - (stackMs + otherMs) * pixelsPerMs,
+                                    barWidth, otherMs * pixelsPerMs, otherColor);
+        }
     }
 
-    // Segmento F (top-left vertical)
-    if (seg[5]) {
-        SDL_RenderDrawLine(renderer, x, y, x, y + h / 2);
-        SDL_RenderDrawLine(renderer, x + 1, y, x + 1, y + h / 2);
-        SDL_RenderDrawLine(renderer, x + 2, y, x + 2, y + h / 2);
+    // Líneas de referencia: 16.6 ms (60 FPS) y 33.3 ms (30 FPS)
+    m_textRenderer->addRect(graphX, graphBottom - 16.6f * pixelsPerMs, graphWidth, 1.0f, {255, 255, 255, 120});
+    m_textRenderer->addRect(graphX, graphBottom - graphHeight, graphWidth, 1.0f, {255, 255, 255, 120});
+
+    // Leyenda: cuadro de color junto a cada línea de etapa (la línea 0 son los percentiles)
+    const float textX = graphX + legendIndent;
+    const float textY = graphBottom + padding;
+    const float lineHeight = TextRenderer::LINE_HEIGHT * textScale;
+    for (size_t stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        m_textRenderer->addRect(graphX, textY + (stage + 1) * lineHeight,
+                                TextRenderer::GLYPH_HEIGHT * textScale, TextRenderer::GLYPH_HEIGHT * textScale,
+                                STAGE_COLORS[stage]);
     }
 
-    // Segmento G (middle horizontal)
-    if (seg[6]) {
-        SDL_RenderDrawLine(renderer, x, y + h / 2, x + w, y + h / 2);
-        SDL_RenderDrawLine(renderer, x, y + h / 2 - 1, x + w, y + h / 2 - 1);
-        SDL_RenderDrawLine(renderer, x, y + h / 2 + 1, x + w, y + h / 2 + 1);
+    m_textRenderer->addText(text, textX, textY, textScale, {255, 255, 255, 255});
+    m_textRenderer->flush();
+}
+
+/**
+ * @brief Dibuja una barra de progreso centrada en la pantalla
+ * @param fraction Progreso [0, 1]
+ * @param label Texto sobre la barra
+ */
+void Renderer::drawProgressBar(float fraction, const char* label) {
+    if (!m_textRenderer) {
+        return;
     }
+
+    int screenW = 0;
+    int screenH = 0;
+    SDL_GetRendererOutputSize(m_renderer, &screenW, &screenH);
+
+    const float scale = 2.0f;
+    const float barWidth = std::min(480.0f, screenW * 0.6f);
+    const float barHeight = 20.0f;
+    const float barX = (screenW - barWidth) * 0.5f;
+    const float barY = (screenH - barHeight) * 0.5f;
+
+    float textW = 0.0f;
+    float textH = 0.0f;
+    TextRenderer::measureText(label, scale, textW, textH);
+
+    m_textRenderer->addText(label, (screenW - textW) * 0.5f, barY - textH - 10.0f, scale, {255, 255, 255, 255});
+    m_textRenderer->addRect(barX, barY, barWidth, barHeight, {0, 0, 0, 160});
+    m_textRenderer->addRect(barX + 2.0f, barY + 2.0f, (barWidth - 4.0f) * std::clamp(fraction, 0.0f, 1.0f),
+                            barHeight - 4.0f, {80, 200, 80, 255});
+    m_textRenderer->flush();
 }
 
 /**
@@ -1138,39 +946,7 @@ static void drawDigit(SDL_Renderer* renderer, int x, int y, int digit, int scale
  * @param fps Valor de FPS a dibujar
  */
 void Renderer::drawFPS(int fps) {
-    const int startX = 20;
-    const int startY = 20;
-    const int scale = 8;
-    const int digitWidth = scale * 4;  // Aumentado: más espacio entre dígitos
-    Uint8 color[3] = {255, 255, 0};  // Amarillo brillante
-
-    // Extraer dígitos
-    int fpsCopy = fps;
-    int digits[3] = {0};
-    int numDigits = 0;
-
-    if (fpsCopy == 0) {
-        digits[0] = 0;
-        numDigits = 1;
-    } else {
-        while (fpsCopy > 0 && numDigits < 3) {
-            digits[numDigits++] = fpsCopy % 10;
-            fpsCopy /= 10;
-        }
-    }
-
-    // Dibujar dígitos de derecha a izquierda
-    for (int i = numDigits - 1; i >= 0; i--) {
-        int x = startX + (numDigits - 1 - i) * digitWidth;
-        drawDigit(m_renderer, x, startY, digits[i], scale, color);
-    }
-
-    // Dibujar "FPS:" texto simple
-    SDL_Rect fpsRect;
-    fpsRect.x = startX + numDigits * digitWidth + 8;
-    fpsRect.y = startY + scale;
-    fpsRect.w = 4;
-    fpsRect.h = scale * 2;
-    SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 255);
-    SDL_RenderFillRect(m_renderer, &fpsRect);  // Barra vertical (F)
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "FPS: %d", fps);
+    drawDebugText(buffer, 20, 20);
 }
@@ -0,0 +1,251 @@
+/**
+ * @file TextRenderer.cpp
+ * @brief Implementación del texto de depuración con atlas de glifos
+ */
+
+#include "rendering/TextRenderer.hpp"
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief Glifo de la fuente embebida: 7 filas de 5 bits (bit 4 = columna izquierda)
+ */
+struct GlyphBitmap {
+    char character;
+    uint8_t rows[TextRenderer::GLYPH_HEIGHT];
+};
+
+// Fuente bitmap 5x7 hecha a mano (estilo LCD clásico)
+constexpr GlyphBitmap FONT[] = {
+    {'0', {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}},
+    {'1', {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+    {'2', {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}},
+    {'3', {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}},
+    {'4', {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}},
+    {'5', {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}},
+    {'6', {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}},
+    {'7', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}},
+    {'8', {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}},
+    {'9', {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}},
+    {'A', {0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11}},
+    {'B', {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}},
+    {'C', {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}},
+    {'D', {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}},
+    {'E', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}},
+    {'F', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}},
+    {'G', {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}},
+    {'H', {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+    {'I', {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+    {'J', {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}},
+    {'K', {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}},
+    {'L', {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}},
+    {'M', {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}},
+    {'N', {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}},
+    {'O', {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+    {'P', {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}},
+    {'Q', {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}},
+    {'R', {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}},
+    {'S', {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}},
+    {'T', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}},
+    {'U', {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+    {'V', {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}},
+    {'W', {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}},
+    {'X', {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}},
+    {'Y', {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04}},
+    {'Z', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}},
+    {'.', {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}},
+    {',', {0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08}},
+    {':', {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}},
+    {'/', {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}},
+    {'-', {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}},
+    {'+', {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00}},
+    {'=', {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00}},
+    {'%', {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}},
+    {'(', {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}},
+    {')', {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}},
+    {'[', {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E}},
+    {']', {0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E}},
+    {'<', {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02}},
+    {'>', {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08}},
+    {'_', {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}},
+    {'|', {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}},
+    {'!', {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04}},
+    {'?', {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}},
+    {'#', {0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A}},
+};
+
+constexpr int FONT_GLYPH_COUNT = static_cast<int>(sizeof(FONT) / sizeof(FONT[0]));
+
+} // namespace
+
+TextRenderer::TextRenderer(SDL_Renderer* renderer)
+    : m_renderer(renderer)
+{
+    m_glyphCell.fill(-1);
+    m_vertices.reserve(1024);
+    m_indices.reserve(1536);
+}
+
+TextRenderer::~TextRenderer() {
+    if (m_atlas) {
+        SDL_DestroyTexture(m_atlas);
+        m_atlas = nullptr;
+    }
+}
+
+bool TextRenderer::init() {
+    static_assert(FONT_GLYPH_COUNT + 1 <= ATLAS_COLUMNS * ATLAS_ROWS, "El atlas no tiene celdas suficientes");
+
+    // Rasterizar la fuente a RGBA (blanco opaco / transparente).
+    // El color final se aplica por vértice.
+    std::vector<uint32_t> pixels(ATLAS_WIDTH * ATLAS_HEIGHT, 0);
+    const uint32_t white = 0xFFFFFFFFu;
+
+    for (int cell = 0; cell < FONT_GLYPH_COUNT; cell++) {
+        const GlyphBitmap& glyph = FONT[cell];
+        const int originX = (cell % ATLAS_COLUMNS) * CELL_WIDTH;
+        const int originY = (cell / ATLAS_COLUMNS) * CELL_HEIGHT;
+
+        for (int row = 0; row < GLYPH_HEIGHT; row++) {
+            for (int col = 0; col < GLYPH_WIDTH; col++) {
+                if (glyph.rows[row] & (0x10 >> col)) {
+                    pixels[(originY + row) * ATLAS_WIDTH + originX + col] = white;
+                }
+            }
+        }
+
+        m_glyphCell[static_cast<unsigned char>(glyph.character)] = static_cast<int16_t>(cell);
+    }
+
+    // Celda sólida para fondos (addRect)
+    m_solidCell = FONT_GLYPH_COUNT;
+    {
+        const int originX = (m_solidCell % ATLAS_COLUMNS) * CELL_WIDTH;
+        const int originY = (m_solidCell / ATLAS_COLUMNS) * CELL_HEIGHT;
+        for (int row = 0; row < GLYPH_HEIGHT; row++) {
+            for (int col = 0; col < GLYPH_WIDTH; col++) {
+                pixels[(originY + row) * ATLAS_WIDTH + originX + col] = white;
+            }
+        }
+    }
+
+    m_glyphCell[' '] = -1;  // El espacio solo avanza
+    m_fallbackCell = m_glyphCell['?'];
+
+    m_atlas = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC,
+                                ATLAS_WIDTH, ATLAS_HEIGHT);
+    if (!m_atlas) {
+        std::cerr << "Error al crear atlas de texto: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    SDL_UpdateTexture(m_atlas, nullptr, pixels.data(), ATLAS_WIDTH * static_cast<int>(sizeof(uint32_t)));
+    SDL_SetTextureBlendMode(m_atlas, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(m_atlas, SDL_ScaleModeNearest);  // Píxeles nítidos al escalar
+    return true;
+}
+
+void TextRenderer::addQuad(float x, float y, float w, float h,
+                           float srcX, float srcY, float srcW, float srcH, SDL_Color color) {
+    const float u0 = srcX / ATLAS_WIDTH;
+    const float v0 = srcY / ATLAS_HEIGHT;
+    const float u1 = (srcX + srcW) / ATLAS_WIDTH;
+    const float v1 = (srcY + srcH) / ATLAS_HEIGHT;
+
+    const int base = static_cast<int>(m_vertices.size());
+    m_vertices.push_back({{x, y}, color, {u0, v0}});
+    m_vertices.push_back({{x + w, y}, color, {u1, v0}});
+    m_vertices.push_back({{x + w, y + h}, color, {u1, v1}});
+    m_vertices.push_back({{x, y + h}, color, {u0, v1}});
+
+    m_indices.push_back(base);
+    m_indices.push_back(base + 1);
+    m_indices.push_back(base + 2);
+    m_indices.push_back(base);
+    m_indices.push_back(base + 2);
+    m_indices.push_back(base + 3);
+}
+
+void TextRenderer::addText(const char* text, float x, float y, float scale, SDL_Color color) {
+    if (!m_atlas || !text) {
+        return;
+    }
+
+    const float glyphW = GLYPH_WIDTH * scale;
+    const float glyphH = GLYPH_HEIGHT * scale;
+    float penX = x;
+    float penY = y;
+
+    for (const char* c = text; *c; c++) {
+        unsigned char ch = static_cast<unsigned char>(*c);
+
+        if (ch == '\n') {
+            penX = x;
+            penY += LINE_HEIGHT * scale;
+            continue;
+        }
+
+        if (ch >= 'a' && ch <= 'z') {
+            ch = static_cast<unsigned char>(ch - 'a' + 'A');
+        }
+
+        if (ch != ' ') {
+            int cell = (ch < m_glyphCell.size()) ? m_glyphCell[ch] : -1;
+            if (cell < 0) {
+                cell = m_fallbackCell;
+            }
+            addQuad(penX, penY, glyphW, glyphH,
+                    static_cast<float>((cell % ATLAS_COLUMNS) * CELL_WIDTH),
+                    static_cast<float>((cell / ATLAS_COLUMNS) * CELL_HEIGHT),
+                    static_cast<float>(GLYPH_WIDTH), static_cast<float>(GLYPH_HEIGHT), color);
+        }
+
+        penX += GLYPH_ADVANCE * scale;
+    }
+}
+
+void TextRenderer::addRect(float x, float y, float w, float h, SDL_Color color) {
+    if (!m_atlas) {
+        return;
+    }
+
+    // Muestrear un texel del interior de la celda sólida (lejos de los bordes transparentes)
+    addQuad(x, y, w, h,
+            static_cast<float>((m_solidCell % ATLAS_COLUMNS) * CELL_WIDTH + GLYPH_WIDTH / 2),
+            static_cast<float>((m_solidCell / ATLAS_COLUMNS) * CELL_HEIGHT + GLYPH_HEIGHT / 2),
+            1.0f, 1.0f, color);
+}
+
+void TextRenderer::measureText(const char* text, float scale, float& width, float& height) {
+    int maxColumns = 0;
+    int columns = 0;
+    int lines = 1;
+
+    for (const char* c = text; *c; c++) {
+        if (*c == '\n') {
+            lines++;
+            columns = 0;
+            continue;
+        }
+        columns++;
+        if (columns > maxColumns) {
+            maxColumns = columns;
+        }
+    }
+
+    width = (maxColumns > 0 ? maxColumns * GLYPH_ADVANCE - 1 : 0) * scale;
+    height = ((lines - 1) * LINE_HEIGHT + GLYPH_HEIGHT) * scale;
+}
+
+void TextRenderer::flush() {
+    if (!m_vertices.empty()) {
+        // UNA sola llamada de dibujo para todo el texto acumulado
+        SDL_RenderGeometry(m_renderer, m_atlas,
+                           m_vertices.data(), static_cast<int>(m_vertices.size()),
+                           m_indices.data(), static_cast<int>(m_indices.size()));
+    }
+
+    m_vertices.clear();
+    m_indices.clear();
+}
@@ -0,0 +1,289 @@
+/**
+ * @file TileListBuilder.cpp
+ * @brief Implementación de la construcción de la lista de tiles visibles
+ */
+
+#include "rendering/TileListBuilder.hpp"
+#include <algorithm>
+
+void TileListBuilder::build(const std::vector<Chunk*>& chunks,
+                            const std::vector<const ImpostorChunk*>& impostors,
+                            const Camera& camera, int screenWidth, int screenHeight,
+                            TileList& tiles, TileListStats& stats) {
+    // OPTIMIZACIÓN: clear() de vectores mantiene la capacidad sin reallocation
+    tiles.clear();
+    stats = TileListStats();
+
+    // Obtener posición del jugador para cálculos de distancia LOD
+    float camX, camY, camZ;
+    camera.getPosition(camX, camY, camZ);
+
+    for (const Chunk* chunk : chunks) {
+        if (!chunk) continue;
+
+        ChunkPos chunkPos = chunk->getPosition();
+        int worldXStart = chunkPos.x * BlockConfig::CHUNK_SIZE;
+        int worldZStart = chunkPos.z * BlockConfig::CHUNK_SIZE;
+
+        // OPTIMIZACIÓN 9: LOD SYSTEM - Calcular distancia del chunk al jugador
+        // QUICK WIN #1: AGGRESSIVE LOD - Thresholds reducidos para más culling agresivo
+        float chunkCenterX = worldXStart + BlockConfig::CHUNK_SIZE * 0.5f;
+        float chunkCenterZ = worldZStart + BlockConfig::CHUNK_SIZE * 0.5f;
+        float distX = chunkCenterX - camX;
+        float distZ = chunkCenterZ - camZ;
+        float distanceSquared = distX * distX + distZ * distZ;
+
+        // Determinar nivel de detalle según distancia (AGGRESSIVE LOD)
+        // LOD 0: 0-6 chunks (completo) - reducido de 8
+        // LOD 1: 6-10 chunks (medio) - reducido de 8-16
+        // LOD 2: 10+ chunks (solo superficie, sin recorrer bloques)
+        int lodLevel = 0;
+        const float lod1Distance = BlockConfig::CHUNK_SIZE * 6.0f;  // ~48 bloques (reducido de 64)
+        const float lod2Distance = BlockConfig::CHUNK_SIZE * 10.0f; // ~80 bloques (reducido de 128)
+
+        if (distanceSquared > lod2Distance * lod2Distance) {
+            lodLevel = 2;  // Muy lejos - mínimo detalle
+        } else if (distanceSquared > lod1Distance * lod1Distance) {
+            lodLevel = 1;  // Medio lejos - detalle medio
+        }
+        // lodLevel 0: Cerca - detalle completo
+
+        // Bounding box culling - descartar chunk completo si está fuera de pantalla.
+        // El volumen va desde el bloque más bajo que dibuja el LOD, no desde
+        // minHeight: LOD 0 dibuja caras expuestas hasta y=0 (bordes del chunk,
+        // cuevas), LOD 1 las últimas 16 capas de cada columna y LOD 2 el suelo
+        // bajo los árboles (groundY = maxY - 1)
+        int lowestY = 0;
+        if (lodLevel == 1) {
+            lowestY = std::max(0, chunk->getMinHeight() - 15);
+        } else if (lodLevel == 2) {
+            lowestY = std::max(0, chunk->getMinHeight() - 1);
+        }
+        if (!isColumnRangeVisible(chunkPos, lowestY, chunk->getMaxHeight(),
+                                  camera, screenWidth, screenHeight)) {
+            continue;
+        }
+        stats.drawnChunks++;
+
+        // OPTIMIZACIÓN: LOD 2 por superficie - un tile por columna (más el árbol)
+        // leído del SurfaceColumn cacheado del chunk. No se accede a ningún bloque.
+        if (lodLevel >= 2) {
+            addSurfaceTiles(chunkPos, chunk->getSurfaceColumns(), camera, screenWidth, screenHeight,
+                            tiles, stats);
+            continue;
+        }
+
+        // Recorrer todos los bloques del chunk (OCCLUSION CULLING con heightmap)
+        for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+            for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+                // OPTIMIZACIÓN: Solo iterar hasta la altura máxima de esta columna
+                int maxY = chunk->getMaxY(x, z);
+
+                for (int y = 0; y <= maxY; y++) {
+                    const Block& block = chunk->getBlockUnsafe(x, y, z);
+
+                    // Solo renderizar bloques sólidos
+                    if (!block.esSolido()) {
+                        continue;
+                    }
+
+                    stats.solidBlocks++;
+
+                    // OPTIMIZACIÓN 9: LOD - Skip bloques underground según nivel de detalle
+                    // (LOD 2 ya se resolvió arriba con addSurfaceTiles)
+                    if (lodLevel == 1) {
+                        // LOD 1: Solo renderizar bloques superficiales (últimos 15 de la columna)
+                        int surfaceY = maxY;
+                        if (y < surfaceY - 15) {
+                            continue;  // Skip bloques profundos
+                        }
+                    }
+                    // lodLevel 0: Renderizar todos los bloques (completo)
+
+                    // OPTIMIZACIÓN 7: FACE CULLING - No renderizar bloques completamente ocultos
+                    // Un bloque es visible si AL MENOS UNA de sus 6 caras está expuesta (tiene vecino aire)
+                    // En LOD 1 y 2, skip face culling para mejorar rendimiento
+                    bool hasExposedFace = true;  // Default para LOD >= 1
+
+                    if (lodLevel == 0) {
+                        // LOD 0: Face culling completo
+                        hasExposedFace = false;
+
+                        // Verificar cara SUPERIOR (y+1) - la más importante en isométrico
+                        if (y < BlockConfig::WORLD_HEIGHT - 1) {
+                            const Block& above = chunk->getBlockUnsafe(x, y + 1, z);
+                            // Si el bloque encima es un árbol, consideramos que la cara superior está expuesta
+                            // (queremos ver el grass debajo del árbol)
+                            bool isAboveTree = (above.type == BlockType::ARBOL_SECO ||
+                                              above.type == BlockType::ARBOL_GRASS ||
+                                              above.type == BlockType::ARBOL_SANGRE);
+                            if (!above.esSolido() || isAboveTree) {
+                                hasExposedFace = true;
+                            }
+                        } else {
+                            hasExposedFace = true;  // Borde superior del mundo
+                        }
+
+                        // Verificar caras LATERALES si la superior no está expuesta.
+                        // En el borde del chunk se mira el vecino publicado; sin
+                        // vecino la cara se considera expuesta
+                        if (!hasExposedFace) {
+                            // Cara X+ (este)
+                            if (x < BlockConfig::CHUNK_SIZE - 1) {
+                                const Block& east = chunk->getBlockUnsafe(x + 1, y, z);
+                                if (!east.esSolido()) hasExposedFace = true;
+                            } else if (const Chunk* neighbor = chunk->getNeighbor(ChunkSide::EAST)) {
+                                if (!neighbor->getBlockUnsafe(0, y, z).esSolido()) hasExposedFace = true;
+                            } else {
+                                hasExposedFace = true;  // Borde del chunk sin vecino
+                            }
+
+                            // Cara X- (oeste)
+                            if (!hasExposedFace && x > 0) {
+                                const Block& west = chunk->getBlockUnsafe(x - 1, y, z);
+                                if (!west.esSolido()) hasExposedFace = true;
+                            } else if (!hasExposedFace && x == 0) {
+                                const Chunk* neighbor = chunk->getNeighbor(ChunkSide::WEST);
+                                if (!neighbor || !neighbor->getBlockUnsafe(BlockConfig::CHUNK_SIZE - 1, y, z).esSolido()) {
+                                    hasExposedFace = true;
+                                }
+                            }
+
+                            // Cara Z+ (sur)
+                            if (!hasExposedFace && z < BlockConfig::CHUNK_SIZE - 1) {
+                                const Block& south = chunk->getBlockUnsafe(x, y, z + 1);
+                                if (!south.esSolido()) hasExposedFace = true;
+                            } else if (!hasExposedFace && z == BlockConfig::CHUNK_SIZE - 1) {
+                                const Chunk* neighbor = chunk->getNeighbor(ChunkSide::SOUTH);
+                                if (!neighbor || !neighbor->getBlockUnsafe(x, y, 0).esSolido()) {
+                                    hasExposedFace = true;
+                                }
+                            }
+
+                            // Cara Z- (norte)
+                            if (!hasExposedFace && z > 0) {
+                                const Block& north = chunk->getBlockUnsafe(x, y, z - 1);
+                                if (!north.esSolido()) hasExposedFace = true;
+                            } else if (!hasExposedFace && z == 0) {
+                                const Chunk* neighbor = chunk->getNeighbor(ChunkSide::NORTH);
+                                if (!neighbor || !neighbor->getBlockUnsafe(x, y, BlockConfig::CHUNK_SIZE - 1).esSolido()) {
+                                    hasExposedFace = true;
+                                }
+                            }
+                        }
+                    }
+
+                    // QUICK WIN #3: Per-Block Frustum Culling optimizado según LOD
+                    float worldX = static_cast<float>(worldXStart + x);
+                    float worldZ = static_cast<float>(worldZStart + z);
+                    float screenX, screenY;
+                    camera.worldToScreen(worldX, static_cast<float>(y), worldZ, screenX, screenY);
+
+                    // Para LOD 0 y 1, hacer face culling primero (más preciso pero más costoso)
+                    if (!hasExposedFace) {
+                        continue;  // Skip - occlusion culling
+                    }
+
+                    // Frustum culling normal para chunks cercanos
+                    const int margin = 100;  // Margen generoso para bloques cercanos
+                    if (screenX < -margin || screenX > screenWidth + margin ||
+                        screenY < -margin || screenY > screenHeight + margin) {
+                        stats.culledBlocks++;
+                        continue;  // Fuera de pantalla
+                    }
+
+                    // Agregar a la lista (SoA, clave de profundidad calculada una vez)
+                    tiles.push(screenX, screenY, block.type, chunk->getVariantUnsafe(x, y, z),
+                               worldXStart + x, y, worldZStart + z);
+                    stats.addedBlocks++;
+                }
+            }
+        }
+    }
+
+    // OPTIMIZACIÓN: Horizonte lejano con impostores (solo superficie, sin bloques).
+    // Sus tiles entran en el mismo depth sort que el terreno.
+    for (const ImpostorChunk* impostor : impostors) {
+        if (!isColumnRangeVisible(impostor->position, impostor->minHeight, impostor->maxHeight,
+                                  camera, screenWidth, screenHeight)) {
+            continue;
+        }
+        addSurfaceTiles(impostor->position, impostor->surface, camera, screenWidth, screenHeight,
+                        tiles, stats);
+    }
+}
+
+bool TileListBuilder::isColumnRangeVisible(ChunkPos pos, int minHeight, int maxHeight, const Camera& camera,
+                                           int screenWidth, int screenHeight) {
+    // OPTIMIZACIÓN: AABB exacto en pantalla del volumen ocupado del chunk
+    // Los anclajes de los tiles van de (x0, z0) a (x0+7, z0+7) en horizontal y de
+    // minHeight (el bloque dibujado más bajo) a maxHeight en vertical. En la proyección isométrica
+    // cada extremo de pantalla depende de una sola esquina del volumen:
+    // - Izquierda: (x0, z1)         - Derecha: (x1, z0)
+    // - Arriba:    (x0, maxY, z0)   - Abajo:   (x1, minY, z1)
+    const float x0 = static_cast<float>(pos.x * BlockConfig::CHUNK_SIZE);
+    const float z0 = static_cast<float>(pos.z * BlockConfig::CHUNK_SIZE);
+    const float x1 = x0 + (BlockConfig::CHUNK_SIZE - 1);
+    const float z1 = z0 + (BlockConfig::CHUNK_SIZE - 1);
+    const float minY = static_cast<float>(minHeight);
+    const float maxY = static_cast<float>(maxHeight);
+
+    float left, right, top, bottom, unused;
+    camera.worldToScreen(x0, minY, z1, left, unused);
+    camera.worldToScreen(x1, minY, z0, right, unused);
+    camera.worldToScreen(x0, maxY, z0, unused, top);
+    camera.worldToScreen(x1, minY, z1, unused, bottom);
+
+    // Extender por el tamaño de los sprites: se dibujan centrados en X
+    // y con la base en el anclaje (crecen hacia arriba)
+    const float spriteSize = MAX_TILE_SPRITE_SIZE * camera.getZoom();
+    left -= spriteSize * 0.5f;
+    right += spriteSize * 0.5f;
+    top -= spriteSize;
+
+    return !(right < 0.0f || left > screenWidth ||
+             bottom < 0.0f || top > screenHeight);
+}
+
+void TileListBuilder::addSurfaceTiles(ChunkPos chunkPos, const std::array<SurfaceColumn, 64>& columns,
+                                      const Camera& camera, int screenWidth, int screenHeight,
+                                      TileList& tiles, TileListStats& stats) {
+    int worldXStart = chunkPos.x * BlockConfig::CHUNK_SIZE;
+    int worldZStart = chunkPos.z * BlockConfig::CHUNK_SIZE;
+
+    // Frustum culling agresivo para chunks lejanos (menos margen)
+    const int margin = 20;
+
+    for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+        for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+            const SurfaceColumn& surface = columns[x + z * BlockConfig::CHUNK_SIZE];
+            if (surface.groundType == BlockType::AIRE) {
+                continue;  // Columna vacía
+            }
+
+            int worldX = worldXStart + x;
+            int worldZ = worldZStart + z;
+            int groundY = surface.groundY;
+
+            float screenX, screenY;
+            camera.worldToScreen(static_cast<float>(worldX), static_cast<float>(groundY),
+                                 static_cast<float>(worldZ), screenX, screenY);
+
+            if (screenX < -margin || screenX > screenWidth + margin ||
+                screenY < -margin || screenY > screenHeight + margin) {
+                stats.culledBlocks++;
+                continue;  // Fuera de pantalla
+            }
+
+            tiles.push(screenX, screenY, surface.groundType, 0, worldX, groundY, worldZ);
+            stats.addedBlocks++;
+
+            // Árbol sobre la superficie: un bloque más arriba = BLOCK_HEIGHT píxeles
+            if (surface.topType != BlockType::AIRE) {
+                tiles.push(screenX, screenY - IsoConfig::BLOCK_HEIGHT * camera.getZoom(),
+                           surface.topType, surface.topVariant, worldX, groundY + 1, worldZ);
+                stats.addedBlocks++;
+            }
+        }
+    }
+}
@@ -0,0 +1,28 @@
+/**
+ * @file AllocationCounter.hpp
+ * @brief Contador de reservas de heap (reemplazo global de operator new)
+ *
+ * AllocationCounter.cpp reemplaza operator new/delete para contar cada
+ * reserva, por thread y en total. Con --check-allocs el juego lo usa para
+ * verificar que los frames en régimen estable no reservan memoria en el
+ * thread principal.
+ *
+ * Solo cuenta las reservas de C++ (new, contenedores de la STL): la memoria
+ * que SDL pide con malloc queda fuera.
+ *
+ * El costo es un incremento por reserva, así que está siempre compilado.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace AllocationCounter {
+
+/** @brief Reservas hechas por el thread actual desde que arrancó */
+uint64_t getThreadAllocations();
+
+/** @brief Reservas hechas por todos los threads */
+uint64_t getTotalAllocations();
+
+} // namespace AllocationCounter
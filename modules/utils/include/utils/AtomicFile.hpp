@@ -0,0 +1,23 @@
+/**
+ * @file AtomicFile.hpp
+ * @brief Escritura atómica de archivos (temporal + rename)
+ *
+ * El contenido se escribe a "<ruta>.tmp" y se renombra sobre la ruta final
+ * solo si la escritura terminó bien: un guardado interrumpido no pisa el
+ * archivo anterior. El temporal se borra en todos los caminos de error.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Reemplaza un archivo con un buffer de forma atómica
+ * @param path Ruta del archivo final
+ * @param data Contenido a escribir
+ * @param size Cantidad de bytes
+ * @return false si no se pudo escribir o renombrar (el archivo anterior queda intacto)
+ */
+bool writeFileAtomic(const std::string& path, const uint8_t* data, size_t size);
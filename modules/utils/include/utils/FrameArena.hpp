@@ -0,0 +1,145 @@
+/**
+ * @file FrameArena.hpp
+ * @brief Arena lineal por frame para contenedores temporales
+ *
+ * Los vectores auxiliares que se crean y destruyen en cada frame (posiciones
+ * a consultar, chunks faltantes, chunks a descargar...) pedían memoria al
+ * heap una y otra vez. La arena reserva un bloque grande una sola vez y
+ * reparte memoria avanzando un puntero; reset() al inicio de cada frame la
+ * recupera toda de golpe.
+ *
+ * Si un frame pide más de lo que cabe, la arena encadena bloques extra y en
+ * el siguiente reset() los funde en un único bloque del tamaño necesario:
+ * tras unos frames de calentamiento el uso en régimen estable no toca el heap.
+ *
+ * ArenaAllocator adapta la arena a los contenedores de la STL (FrameVector).
+ * La memoria de un contenedor de frame solo es válida hasta el próximo
+ * reset(): nunca guardar uno como miembro.
+ *
+ * Solo depende de la STL.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief Asignador lineal (bump allocator) que se vacía una vez por frame
+ *
+ * No es thread-safe: cada arena pertenece a un thread. La instancia
+ * compartida es la del thread principal.
+ */
+class FrameArena {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;  ///< Bloque inicial (bytes)
+
+    /**
+     * @brief Crea la arena con un bloque inicial
+     * @param capacity Tamaño del bloque inicial (bytes)
+     */
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Arena del thread principal (la vacía Game al inicio de cada frame)
+     */
+    static FrameArena& instance();
+
+    /**
+     * @brief Reserva memoria de la arena
+     * @param size Bytes a reservar
+     * @param alignment Alineación (potencia de 2)
+     * @return Puntero válido hasta el próximo reset()
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Devuelve memoria a la arena
+     *
+     * Solo recupera la memoria si es la última reserva (p.ej. un vector
+     * temporal que se destruye antes de reservar otra cosa). En otro caso
+     * no hace nada: se recupera en reset().
+     */
+    void deallocate(void* pointer, size_t size);
+
+    /**
+     * @brief Libera todo lo reservado desde el último reset()
+     *
+     * Si el frame necesitó bloques extra, los reemplaza por un único bloque
+     * que cubre el pico (la única vez que reset() usa el heap).
+     */
+    void reset();
+
+    /** @brief Bytes reservados desde el último reset() */
+    size_t getUsedBytes() const { return m_usedBefore + m_offset; }
+
+    /** @brief Capacidad total de los bloques actuales (bytes) */
+    size_t getCapacity() const;
+
+    /** @brief Máximo de bytes usados en un frame desde la creación */
+    size_t getPeakBytes() const { return m_peakBytes; }
+
+    /** @brief Veces que un frame excedió la capacidad y encadenó un bloque */
+    size_t getOverflowCount() const { return m_overflowCount; }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    /** @brief Encadena un bloque nuevo con espacio para al menos minSize bytes */
+    void addBlock(size_t minSize);
+
+    std::vector<Block> m_blocks;   ///< Bloque principal + extras del frame actual
+    size_t m_current = 0;          ///< Bloque donde se reserva ahora
+    size_t m_offset = 0;           ///< Bytes usados del bloque actual
+    size_t m_usedBefore = 0;       ///< Bytes usados en los bloques anteriores al actual
+    size_t m_peakBytes = 0;
+    size_t m_overflowCount = 0;
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief Allocator de la STL sobre una FrameArena
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    /** @brief Usa la arena del thread principal */
+    ArenaAllocator() noexcept : m_arena(&FrameArena::instance()) {}
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept : m_arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.getArena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        m_arena->deallocate(pointer, count * sizeof(T));
+    }
+
+    FrameArena* getArena() const noexcept { return m_arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.getArena(); }
+
+private:
+    FrameArena* m_arena;
+};
+
+/**
+ * @brief Vector temporal de frame (memoria de la arena del thread principal)
+ */
+template <typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
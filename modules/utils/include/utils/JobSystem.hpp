@@ -0,0 +1,233 @@
+/**
+ * @file JobSystem.hpp
+ * @brief Scheduler de jobs compartido con work stealing
+ *
+ * Un único pool de workers para todo el proyecto: la generación de chunks,
+ * y en el futuro la lista de render, pathfinding o partículas, envían jobs
+ * aquí en lugar de crear sus propios threads.
+ *
+ * Diseño:
+ * - Cada worker tiene su deque: empuja y toma por detrás (LIFO, datos
+ *   calientes en cache); los demás le roban por delante (FIFO)
+ * - Los jobs enviados desde fuera de los workers (p.ej. el thread principal)
+ *   entran a una cola global FIFO, consultada antes de robar
+ * - Dependencias: un job no se encola hasta que terminan los jobs de los
+ *   que depende (contador atómico + lista de continuaciones)
+ * - Jobs de thread principal: nunca los ejecuta un worker; se vacían con
+ *   runMainThreadJobs() (una vez por frame) o al esperar desde el thread principal
+ * - Jobs de alta prioridad: van a una cola propia que todos los threads
+ *   consultan antes que cualquier otra (p.ej. chunks pedidos por adelantado
+ *   en la dirección de movimiento)
+ * - wait() ayuda: mientras el job no termina, el thread que espera ejecuta otros
+ *
+ * Cada deque tiene su propio mutex: solo compiten el dueño y un ladrón a la
+ * vez, nunca todos los workers por una cola central.
+ *
+ * Solo depende de la STL.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+
+namespace detail {
+
+/**
+ * @brief Estado compartido de un job (lo referencian el handle y el scheduler)
+ */
+struct JobState {
+    std::function<void()> function;
+    bool mainThreadOnly = false;
+    bool highPriority = false;
+    std::atomic<int> pendingDependencies{1};  ///< Dependencias sin terminar (+1 mientras se programa)
+    std::atomic<bool> done{false};
+
+    std::mutex continuationMutex;                         ///< Protege continuations y la transición a done
+    std::vector<std::shared_ptr<JobState>> continuations; ///< Jobs que esperan a este
+};
+
+} // namespace detail
+
+/**
+ * @class JobHandle
+ * @brief Referencia a un job programado (para esperar o declarar dependencias)
+ *
+ * Copiable y barato. Un handle vacío cuenta como terminado.
+ */
+class JobHandle {
+public:
+    JobHandle() = default;
+
+    /** @brief true si el job terminó (o el handle está vacío) */
+    bool isDone() const { return !m_state || m_state->done.load(std::memory_order_acquire); }
+
+    /** @brief true si el handle referencia un job */
+    bool isValid() const { return m_state != nullptr; }
+
+private:
+    friend class JobSystem;
+    explicit JobHandle(std::shared_ptr<detail::JobState> state) : m_state(std::move(state)) {}
+
+    std::shared_ptr<detail::JobState> m_state;
+};
+
+/**
+ * @class JobSystem
+ * @brief Pool de workers con deques por worker y work stealing
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Crea el pool
+     * @param workerCount Cantidad de workers (0 = núcleos - 1, mínimo 1)
+     *
+     * El thread que construye el JobSystem queda registrado como thread principal.
+     */
+    explicit JobSystem(unsigned workerCount = 0);
+
+    /**
+     * @brief Detiene los workers (los jobs pendientes se descartan)
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Instancia compartida del proyecto (se crea en el primer uso)
+     *
+     * El primer uso debe ocurrir en el thread principal.
+     */
+    static JobSystem& instance();
+
+    /**
+     * @brief Programa un job en los workers
+     * @param function Trabajo a ejecutar
+     * @param dependencies Jobs que deben terminar antes
+     * @return Handle del job
+     */
+    JobHandle schedule(std::function<void()> function, std::initializer_list<JobHandle> dependencies = {});
+
+    /** @brief Igual que schedule() con las dependencias en un vector */
+    JobHandle schedule(std::function<void()> function, const std::vector<JobHandle>& dependencies);
+
+    /**
+     * @brief Programa un job que los workers toman antes que los demás
+     * @param function Trabajo urgente
+     * @param dependencies Jobs que deben terminar antes
+     * @return Handle del job
+     *
+     * Los jobs de alta prioridad se atienden en orden FIFO entre sí.
+     */
+    JobHandle scheduleHighPriority(std::function<void()> function,
+                                   std::initializer_list<JobHandle> dependencies = {});
+
+    /**
+     * @brief Programa un job que solo puede ejecutar el thread principal
+     * @param function Trabajo (p.ej. llamadas a SDL o acceso a estado del Game)
+     * @param dependencies Jobs que deben terminar antes
+     * @return Handle del job
+     */
+    JobHandle scheduleMainThread(std::function<void()> function,
+                                 std::initializer_list<JobHandle> dependencies = {});
+
+    /**
+     * @brief Ejecuta los jobs de thread principal pendientes
+     * @return Cantidad de jobs ejecutados
+     *
+     * Llamar una vez por frame desde el thread principal.
+     */
+    int runMainThreadJobs();
+
+    /**
+     * @brief Espera a que termine un job, ejecutando otros mientras tanto
+     * @param handle Job a esperar
+     */
+    void wait(const JobHandle& handle);
+
+    /** @brief Espera a todos los handles */
+    void waitAll(const std::vector<JobHandle>& handles);
+
+    /**
+     * @brief Ejecuta en el thread actual un job de las colas de los workers, si hay alguno
+     * @return false si no había jobs listos
+     *
+     * Para esperas sin handle (p.ej. hasta que se publique un conjunto de
+     * chunks): el thread que espera ayuda en lugar de dormir. Nunca ejecuta
+     * jobs de thread principal: esos corren en runMainThreadJobs().
+     */
+    bool runWorkerJob();
+
+    /**
+     * @brief Ejecuta body sobre [begin, end) partido en bloques de grainSize
+     * @param begin, end Rango de índices
+     * @param grainSize Índices por job (0 = automático: ~4 bloques por thread)
+     * @param body Función (inicio, fin) de un bloque
+     *
+     * Bloquea hasta terminar. El thread que llama ejecuta el primer bloque y
+     * ayuda con el resto mientras espera.
+     */
+    void parallelFor(size_t begin, size_t end, size_t grainSize,
+                     const std::function<void(size_t, size_t)>& body);
+
+    /** @brief Cantidad de workers (sin contar el thread principal) */
+    unsigned getWorkerCount() const { return static_cast<unsigned>(m_workers.size()); }
+
+    /** @brief true si el thread actual es el thread principal */
+    bool isMainThread() const { return std::this_thread::get_id() == m_mainThreadId; }
+
+    /** @brief Jobs robados a otro worker desde la creación (estadística) */
+    uint64_t getStealCount() const { return m_stealCount.load(std::memory_order_relaxed); }
+
+private:
+    using JobPtr = std::shared_ptr<detail::JobState>;
+
+    /**
+     * @brief Deque de un worker (o la cola global de entrada)
+     */
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<JobPtr> jobs;
+    };
+
+    JobHandle scheduleState(JobPtr state, const JobHandle* dependencies, size_t dependencyCount);
+
+    /** @brief Encola un job cuyas dependencias ya terminaron */
+    void enqueue(JobPtr job);
+
+    /** @brief Toma un job: alta prioridad, deque propio, cola global, robo. nullptr si no hay */
+    JobPtr findJob();
+
+    /** @brief Ejecuta un job y libera sus continuaciones */
+    void execute(const JobPtr& job);
+
+    /** @brief Ejecuta un job pendiente si hay alguno (usado al esperar) */
+    bool runPendingJob();
+
+    void workerLoop(unsigned index);
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;  ///< Un deque por worker
+    WorkQueue m_globalQueue;                           ///< Jobs enviados desde fuera de los workers
+    WorkQueue m_highPriorityQueue;                     ///< Jobs de alta prioridad (se consultan primero)
+    WorkQueue m_mainThreadQueue;                       ///< Jobs de thread principal
+    std::thread::id m_mainThreadId;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCV;
+    std::atomic<int> m_queuedJobs{0};     ///< Jobs en deques/cola global (para dormir sin perder wakeups)
+    std::atomic<int> m_highPriorityJobs{0};  ///< Jobs en m_highPriorityQueue (evita el lock si está vacía)
+    std::atomic<bool> m_stop{false};
+    std::atomic<uint64_t> m_stealCount{0};
+};
@@ -0,0 +1,97 @@
+/**
+ * @file MPSCQueue.hpp
+ * @brief Cola lock-free de múltiples productores y un consumidor
+ *
+ * Cola enlazada de Vyukov: push() es un exchange atómico sobre la cabeza
+ * más un store del enlace, sin locks ni reintentos (wait-free para los
+ * productores). Solo un thread puede llamar a tryPop().
+ *
+ * Entre el exchange y el store del enlace un elemento ya empujado puede no
+ * ser visible todavía: tryPop() devuelve false y el consumidor lo verá en
+ * su próxima llamada. Para colas que se vacían periódicamente (una vez por
+ * frame) es irrelevante.
+ *
+ * Cada push() reserva un nodo en el heap del productor.
+ *
+ * Solo depende de la STL.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+/**
+ * @class MPSCQueue
+ * @brief Cola FIFO lock-free (muchos productores, un consumidor)
+ * @tparam T Tipo de los elementos (movible y construible por defecto)
+ */
+template <typename T>
+class MPSCQueue {
+public:
+    MPSCQueue() {
+        Node* stub = new Node();
+        m_head.store(stub, std::memory_order_relaxed);
+        m_tail = stub;
+    }
+
+    /**
+     * @brief Destruye los elementos que queden (sin productores activos)
+     */
+    ~MPSCQueue() {
+        while (m_tail) {
+            Node* next = m_tail->next.load(std::memory_order_relaxed);
+            delete m_tail;
+            m_tail = next;
+        }
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    /**
+     * @brief Agrega un elemento (cualquier thread)
+     */
+    void push(T value) {
+        Node* node = new Node();
+        node->value = std::move(value);
+
+        // Publicar el nodo como nueva cabeza y enlazarlo detrás de la anterior
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * @brief Extrae el elemento más antiguo (solo el consumidor)
+     * @param out Elemento extraído
+     * @return false si no hay elementos visibles
+     */
+    bool tryPop(T& out) {
+        Node* next = m_tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+
+        // next pasa a ser el nodo centinela: su valor se mueve fuera
+        out = std::move(next->value);
+        delete m_tail;
+        m_tail = next;
+        return true;
+    }
+
+    /**
+     * @brief true si no hay elementos visibles (solo el consumidor)
+     */
+    bool empty() const {
+        return m_tail->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    std::atomic<Node*> m_head;  ///< Último nodo empujado (productores)
+    Node* m_tail;               ///< Centinela: el siguiente es el más antiguo (consumidor)
+};
@@ -0,0 +1,55 @@
+/**
+ * @file MappedFile.hpp
+ * @brief Archivo de solo lectura mapeado en memoria
+ *
+ * El sistema operativo carga las páginas a medida que se leen: abrir un
+ * archivo grande no copia nada y los datos se usan en su lugar (sin
+ * std::ifstream ni buffers intermedios).
+ *
+ * Windows: CreateFileMapping/MapViewOfFile. Resto: mmap.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Mapeo de solo lectura de un archivo completo (RAII)
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Mapea un archivo (cierra el anterior si lo había)
+     * @param path Ruta del archivo
+     * @return false si no existe, está vacío o no se pudo mapear
+     */
+    bool open(const std::string& path);
+
+    /** @brief Libera el mapeo (los punteros de data() dejan de ser válidos) */
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+
+    /** @brief Contenido del archivo (válido hasta close()) */
+    const uint8_t* data() const { return m_data; }
+
+    /** @brief Tamaño del archivo en bytes */
+    size_t size() const { return m_size; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;     ///< HANDLE del archivo
+    void* m_mapping = nullptr;  ///< HANDLE del mapeo
+#endif
+};
@@ -0,0 +1,114 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief Reemplazo global de operator new/delete con contadores
+ */
+
+#include "utils/AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+    #include <malloc.h>  // _aligned_malloc
+#endif
+
+namespace {
+
+// Contadores triviales: no requieren inicialización dinámica, así que son
+// válidos aunque operator new se llame antes de main
+thread_local uint64_t t_allocations = 0;
+std::atomic<uint64_t> g_allocations{0};
+
+void* allocateCounted(std::size_t size) {
+    t_allocations++;
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* allocateAlignedCounted(std::size_t size, std::size_t alignment) {
+    t_allocations++;
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void* pointer = nullptr;
+    return (posix_memalign(&pointer, alignment, size) == 0) ? pointer : nullptr;
+#endif
+}
+
+void freeAligned(void* pointer) {
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+} // namespace
+
+namespace AllocationCounter {
+
+uint64_t getThreadAllocations() {
+    return t_allocations;
+}
+
+uint64_t getTotalAllocations() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+} // namespace AllocationCounter
+
+// ---------------------------------------------------------------------------
+// Reemplazos globales (todas las variantes que la STL puede usar)
+// ---------------------------------------------------------------------------
+
+void* operator new(std::size_t size) {
+    if (void* pointer = allocateCounted(size)) return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* pointer = allocateCounted(size)) return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocateCounted(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocateCounted(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* pointer = allocateAlignedCounted(size, static_cast<std::size_t>(alignment))) return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* pointer = allocateAlignedCounted(size, static_cast<std::size_t>(alignment))) return pointer;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAlignedCounted(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAlignedCounted(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { freeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { freeAligned(pointer); }
@@ -0,0 +1,32 @@
+/**
+ * @file AtomicFile.cpp
+ * @brief Implementación de la escritura atómica de archivos
+ */
+
+#include "utils/AtomicFile.hpp"
+#include <filesystem>
+#include <fstream>
+
+bool writeFileAtomic(const std::string& path, const uint8_t* data, size_t size) {
+    const std::string tempPath = path + ".tmp";
+
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    file.close();  // Los errores del volcado final aparecen al cerrar
+
+    std::error_code error;
+    if (file.fail()) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
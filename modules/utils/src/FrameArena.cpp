@@ -0,0 +1,81 @@
+/**
+ * @file FrameArena.cpp
+ * @brief Implementación de la arena lineal por frame
+ */
+
+#include "utils/FrameArena.hpp"
+#include <algorithm>
+#include <cstdint>
+
+FrameArena::FrameArena(size_t capacity) {
+    addBlock(std::max<size_t>(capacity, 1));
+}
+
+FrameArena& FrameArena::instance() {
+    static FrameArena arena;
+    return arena;
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    for (;;) {
+        Block& block = m_blocks[m_current];
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        const uintptr_t aligned = (base + m_offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        const size_t end = static_cast<size_t>(aligned - base) + size;
+
+        if (end <= block.size) {
+            m_offset = end;
+            m_peakBytes = std::max(m_peakBytes, getUsedBytes());
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // No cabe: pasar al siguiente bloque (o encadenar uno nuevo)
+        if (m_current + 1 >= m_blocks.size()) {
+            m_overflowCount++;
+            addBlock(size + alignment);
+        }
+        m_usedBefore += m_offset;
+        m_current++;
+        m_offset = 0;
+    }
+}
+
+void FrameArena::deallocate(void* pointer, size_t size) {
+    // Solo la última reserva del bloque actual se puede deshacer
+    std::byte* top = m_blocks[m_current].data.get() + m_offset;
+    if (static_cast<std::byte*>(pointer) + size == top) {
+        m_offset -= size;
+    }
+}
+
+void FrameArena::reset() {
+    if (m_blocks.size() > 1) {
+        // Fundir los bloques en uno que cubra el pico (con margen para la
+        // alineación y el crecimiento de los vectores)
+        const size_t capacity = getCapacity() + getCapacity() / 2;
+        m_blocks.clear();
+        addBlock(capacity);
+    }
+
+    m_current = 0;
+    m_offset = 0;
+    m_usedBefore = 0;
+}
+
+size_t FrameArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : m_blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void FrameArena::addBlock(size_t minSize) {
+    // Los bloques extra duplican la capacidad: pocos encadenamientos por frame
+    const size_t size = m_blocks.empty() ? minSize : std::max(minSize, getCapacity());
+
+    Block block;
+    block.data.reset(new std::byte[size]);
+    block.size = size;
+    m_blocks.push_back(std::move(block));
+}
@@ -0,0 +1,316 @@
+/**
+ * @file JobSystem.cpp
+ * @brief Implementación del scheduler con work stealing
+ */
+
+#include "utils/JobSystem.hpp"
+#include <algorithm>
+
+namespace {
+
+// Worker actual (nullptr/-1 fuera de los workers). Se guarda el dueño para
+// que varios JobSystem (p.ej. en el benchmark de escalado) no se mezclen.
+thread_local const JobSystem* t_owner = nullptr;
+thread_local int t_workerIndex = -1;
+
+} // namespace
+
+JobSystem::JobSystem(unsigned workerCount)
+    : m_mainThreadId(std::this_thread::get_id())
+{
+    if (workerCount == 0) {
+        const unsigned cores = std::thread::hardware_concurrency();
+        workerCount = (cores > 1) ? cores - 1 : 1;  // El thread principal también ejecuta jobs al esperar
+    }
+
+    m_queues.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; i++) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stop = true;
+    }
+    m_sleepCV.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+JobSystem& JobSystem::instance() {
+    static JobSystem system;
+    return system;
+}
+
+JobHandle JobSystem::schedule(std::function<void()> function, std::initializer_list<JobHandle> dependencies) {
+    auto state = std::make_shared<detail::JobState>();
+    state->function = std::move(function);
+    return scheduleState(std::move(state), dependencies.begin(), dependencies.size());
+}
+
+JobHandle JobSystem::schedule(std::function<void()> function, const std::vector<JobHandle>& dependencies) {
+    auto state = std::make_shared<detail::JobState>();
+    state->function = std::move(function);
+    return scheduleState(std::move(state), dependencies.data(), dependencies.size());
+}
+
+JobHandle JobSystem::scheduleHighPriority(std::function<void()> function,
+                                          std::initializer_list<JobHandle> dependencies) {
+    auto state = std::make_shared<detail::JobState>();
+    state->function = std::move(function);
+    state->highPriority = true;
+    return scheduleState(std::move(state), dependencies.begin(), dependencies.size());
+}
+
+JobHandle JobSystem::scheduleMainThread(std::function<void()> function,
+                                        std::initializer_list<JobHandle> dependencies) {
+    auto state = std::make_shared<detail::JobState>();
+    state->function = std::move(function);
+    state->mainThreadOnly = true;
+    return scheduleState(std::move(state), dependencies.begin(), dependencies.size());
+}
+
+JobHandle JobSystem::scheduleState(JobPtr state, const JobHandle* dependencies, size_t dependencyCount) {
+    // pendingDependencies empieza en 1: evita que una dependencia que termina
+    // mientras se registran las demás encole el job antes de tiempo
+    for (size_t i = 0; i < dependencyCount; i++) {
+        const JobPtr& dependency = dependencies[i].m_state;
+        if (!dependency) continue;
+
+        std::lock_guard<std::mutex> lock(dependency->continuationMutex);
+        if (!dependency->done.load(std::memory_order_acquire)) {
+            state->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+            dependency->continuations.push_back(state);
+        }
+    }
+
+    JobHandle handle(state);
+    if (state->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        enqueue(std::move(state));
+    }
+    return handle;
+}
+
+void JobSystem::enqueue(JobPtr job) {
+    if (job->mainThreadOnly) {
+        std::lock_guard<std::mutex> lock(m_mainThreadQueue.mutex);
+        m_mainThreadQueue.jobs.push_back(std::move(job));
+        return;
+    }
+
+    // Alta prioridad: a su cola desde cualquier thread. Si no, desde un
+    // worker a su propio deque y desde fuera a la cola global
+    if (job->highPriority) {
+        std::lock_guard<std::mutex> lock(m_highPriorityQueue.mutex);
+        m_highPriorityQueue.jobs.push_back(std::move(job));
+        m_highPriorityJobs.fetch_add(1, std::memory_order_release);
+    } else {
+        WorkQueue& queue = (t_owner == this && t_workerIndex >= 0) ? *m_queues[t_workerIndex] : m_globalQueue;
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    m_queuedJobs.fetch_add(1, std::memory_order_release);
+    {
+        // Tomar el mutex antes de notificar: un worker que está evaluando
+        // el predicado de espera no puede perder este wakeup
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_sleepCV.notify_one();
+}
+
+JobSystem::JobPtr JobSystem::findJob() {
+    JobPtr job;
+    const int self = (t_owner == this) ? t_workerIndex : -1;
+
+    // 0. Alta prioridad (FIFO). El contador evita el lock en el caso habitual
+    if (m_highPriorityJobs.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(m_highPriorityQueue.mutex);
+        if (!m_highPriorityQueue.jobs.empty()) {
+            job = std::move(m_highPriorityQueue.jobs.front());
+            m_highPriorityQueue.jobs.pop_front();
+            m_highPriorityJobs.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // 1. Deque propio por detrás (LIFO)
+    if (!job && self >= 0) {
+        WorkQueue& own = *m_queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+        }
+    }
+
+    // 2. Cola global (FIFO: los pedidos externos se atienden en orden)
+    if (!job) {
+        std::lock_guard<std::mutex> lock(m_globalQueue.mutex);
+        if (!m_globalQueue.jobs.empty()) {
+            job = std::move(m_globalQueue.jobs.front());
+            m_globalQueue.jobs.pop_front();
+        }
+    }
+
+    // 3. Robar por delante a otro worker (los jobs más viejos, normalmente más grandes)
+    if (!job) {
+        const size_t count = m_queues.size();
+        const size_t start = (self >= 0) ? static_cast<size_t>(self) + 1 : 0;
+        for (size_t i = 0; i < count && !job; i++) {
+            const size_t victim = (start + i) % count;
+            if (static_cast<int>(victim) == self) continue;
+
+            WorkQueue& queue = *m_queues[victim];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+                m_stealCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if (job) {
+        m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+void JobSystem::execute(const JobPtr& job) {
+    job->function();
+    job->function = nullptr;  // Liberar capturas aunque alguien conserve el handle
+
+    std::vector<JobPtr> continuations;
+    {
+        std::lock_guard<std::mutex> lock(job->continuationMutex);
+        job->done.store(true, std::memory_order_release);
+        continuations.swap(job->continuations);
+    }
+
+    for (JobPtr& continuation : continuations) {
+        if (continuation->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            enqueue(std::move(continuation));
+        }
+    }
+}
+
+bool JobSystem::runPendingJob() {
+    if (isMainThread()) {
+        JobPtr job;
+        {
+            std::lock_guard<std::mutex> lock(m_mainThreadQueue.mutex);
+            if (!m_mainThreadQueue.jobs.empty()) {
+                job = std::move(m_mainThreadQueue.jobs.front());
+                m_mainThreadQueue.jobs.pop_front();
+            }
+        }
+        if (job) {
+            execute(job);
+            return true;
+        }
+    }
+
+    JobPtr job = findJob();
+    if (job) {
+        execute(job);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::runWorkerJob() {
+    JobPtr job = findJob();
+    if (job) {
+        execute(job);
+        return true;
+    }
+    return false;
+}
+
+int JobSystem::runMainThreadJobs() {
+    // Solo los jobs ya encolados: los que se encolen mientras tanto quedan
+    // para el próximo frame (acota el tiempo de esta llamada)
+    std::unique_lock<std::mutex> lock(m_mainThreadQueue.mutex);
+    if (m_mainThreadQueue.jobs.empty()) {
+        return 0;  // Caso habitual: sin crear el deque local (uno vacío ya reserva memoria)
+    }
+    std::deque<JobPtr> jobs;
+    jobs.swap(m_mainThreadQueue.jobs);
+    lock.unlock();
+
+    for (const JobPtr& job : jobs) {
+        execute(job);
+    }
+    return static_cast<int>(jobs.size());
+}
+
+void JobSystem::wait(const JobHandle& handle) {
+    while (!handle.isDone()) {
+        if (!runPendingJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::waitAll(const std::vector<JobHandle>& handles) {
+    for (const JobHandle& handle : handles) {
+        wait(handle);
+    }
+}
+
+void JobSystem::parallelFor(size_t begin, size_t end, size_t grainSize,
+                            const std::function<void(size_t, size_t)>& body) {
+    if (end <= begin) return;
+
+    const size_t count = end - begin;
+    if (grainSize == 0) {
+        const size_t threads = m_workers.size() + 1;
+        grainSize = std::max<size_t>(1, count / (threads * 4));
+    }
+
+    const size_t blocks = (count + grainSize - 1) / grainSize;
+    if (blocks == 1) {
+        body(begin, end);
+        return;
+    }
+
+    std::vector<JobHandle> handles;
+    handles.reserve(blocks - 1);
+    for (size_t block = 1; block < blocks; block++) {
+        const size_t blockBegin = begin + block * grainSize;
+        const size_t blockEnd = std::min(end, blockBegin + grainSize);
+        handles.push_back(schedule([&body, blockBegin, blockEnd] { body(blockBegin, blockEnd); }));
+    }
+
+    body(begin, std::min(end, begin + grainSize));
+    waitAll(handles);
+}
+
+void JobSystem::workerLoop(unsigned index) {
+    t_owner = this;
+    t_workerIndex = static_cast<int>(index);
+
+    while (!m_stop.load(std::memory_order_acquire)) {
+        JobPtr job = findJob();
+        if (job) {
+            execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepCV.wait(lock, [this] {
+            return m_stop.load(std::memory_order_relaxed) || m_queuedJobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
@@ -1,13 +1,123 @@
 #include "core/Game.hpp"
 #include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * @brief Muestra las opciones de línea de comandos
+ */
+static void printUsage(const char* program) {
+    std::cout << "Uso: " << program << " [opciones]\n"
+              << "  --seed N          Semilla fija del mundo\n"
+              << "  --benchmark       Recorrido scriptado con deltaTime fijo (semilla 12345 si no se indica)\n"
+              << "  --frames N        Frames a medir en modo benchmark (por defecto 2880)\n"
+              << "  --headless        Ventana oculta\n"
+              << "  --out ARCHIVO     JSON de resultados del benchmark (por defecto benchmark.json)\n"
+              << "  --record ARCHIVO  Graba el input de la sesión en un log binario\n"
+              << "  --replay ARCHIVO  Reproduce un log de input (misma semilla y mismos frames)\n"
+              << "  --tick-rate N     Ticks por segundo de la simulación, 1-65535 (por defecto 60)\n"
+              << "  --fps N           Límite de FPS (por defecto 60, 0 = sin límite; sin límite en benchmark)\n"
+              << "  --check-allocs    Verifica que los frames estables no reserven heap (cámara quieta, 600 frames)\n"
+              << "  --no-prefetch     Desactiva el prefetch predictivo de chunks (comparar huecos en el benchmark)\n"
+              << "  --chunk-budget-mb N  Memoria máxima de los chunks cargados en MB (por defecto 64)\n"
+              << "  --load ARCHIVO    Carga un guardado (su semilla y sus bloques modificados; F5 guarda ahí)\n"
+              << "  --save ARCHIVO    Archivo donde F5 guarda las ediciones (por defecto world.sav)\n"
+              << "  --snapshot ARCHIVO  Reanuda la sesión guardada en ARCHIVO y la vuelve a guardar al salir\n"
+              << "  --help            Muestra esta ayuda" << std::endl;
+}
 
 int main(int argc, char* argv[]) {
     std::cout << "=== Juego Isometrico 2D - Sandbox ===" << std::endl;
-    std::cout << "Controles: WASD=Mover, +/-=Zoom, P=Pausar, ESC=Salir" << std::endl;
+    std::cout << "Controles: WASD=Mover, +/-=Zoom, P=Pausar, F5=Guardar, ESC=Salir" << std::endl;
+
+    GameConfig config;
+    bool fpsGiven = false;
+    bool framesGiven = false;
+    bool saveGiven = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if (std::strcmp(arg, "--benchmark") == 0) {
+            config.benchmark = true;
+        } else if (std::strcmp(arg, "--headless") == 0) {
+            config.headless = true;
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            config.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            config.hasSeed = true;  // 0 incluido: una semilla explícita se usa tal cual
+        } else if (std::strcmp(arg, "--frames") == 0 && hasValue) {
+            config.benchmarkFrames = std::atoi(argv[++i]);
+            framesGiven = true;
+        } else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            config.benchmarkOutput = argv[++i];
+        } else if (std::strcmp(arg, "--record") == 0 && hasValue) {
+            config.recordInputPath = argv[++i];
+        } else if (std::strcmp(arg, "--replay") == 0 && hasValue) {
+            config.replayInputPath = argv[++i];
+        } else if (std::strcmp(arg, "--tick-rate") == 0 && hasValue) {
+            config.tickRate = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--fps") == 0 && hasValue) {
+            config.targetFps = std::atoi(argv[++i]);
+            fpsGiven = true;
+        } else if (std::strcmp(arg, "--check-allocs") == 0) {
+            config.checkAllocs = true;
+        } else if (std::strcmp(arg, "--chunk-budget-mb") == 0 && hasValue) {
+            config.chunkBudgetMB = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--no-prefetch") == 0) {
+            config.prefetch = false;
+        } else if (std::strcmp(arg, "--load") == 0 && hasValue) {
+            config.loadPath = argv[++i];
+            if (!saveGiven) {
+                config.savePath = config.loadPath;
+            }
+        } else if (std::strcmp(arg, "--save") == 0 && hasValue) {
+            config.savePath = argv[++i];
+            saveGiven = true;
+        } else if (std::strcmp(arg, "--snapshot") == 0 && hasValue) {
+            config.snapshotPath = argv[++i];
+        } else if (std::strcmp(arg, "--help") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            printUsage(argv[0]);
+            return -1;
+        }
+    }
+
+    // El benchmark siempre usa una semilla fija para que la carga sea repetible
+    if ((config.benchmark || config.checkAllocs) && !config.hasSeed) {
+        config.seed = 12345;
+        config.hasSeed = true;
+    }
+    // ...y mide el costo real de los frames, sin esperas del limitador
+    if ((config.benchmark || config.checkAllocs) && !fpsGiven) {
+        config.targetFps = 0;
+    }
+    if (config.checkAllocs && !framesGiven && !config.benchmark) {
+        config.benchmarkFrames = 600;
+    }
+    if (config.chunkBudgetMB < 1) {
+        config.chunkBudgetMB = 1;
+    }
+    if (config.targetFps < 0) {
+        config.targetFps = 0;
+    }
+    if (config.benchmarkFrames < 1) {
+        config.benchmarkFrames = 1;
+    }
+    if (config.tickRate < 1) {
+        config.tickRate = 1;
+    }
+    if (config.tickRate > UINT16_MAX) {
+        config.tickRate = UINT16_MAX;  // El log de input la guarda en 16 bits
+    }
 
     Game game;
 
-    if (!game.init()) {
+    if (!game.init(config)) {
         std::cerr << "Error al inicializar el juego!" << std::endl;
         return -1;
     }
@@ -15,5 +125,5 @@ int main(int argc, char* argv[]) {
     game.run();
     game.cleanup();
 
-    return 0;
+    return game.allocationCheckFailed() ? 1 : 0;
 }
@@ -0,0 +1,163 @@
+/**
+ * @file bench_job_system.cpp
+ * @brief Benchmark de escalado del JobSystem (work stealing)
+ *
+ * Para 1, 2, 4, ... workers (hasta los núcleos disponibles) mide:
+ * - parallel_for: bloques de cómputo uniforme (tipo generación de terreno)
+ * - parallel_for desbalanceado: el costo crece con el índice (exige robos)
+ * - jobs chicos: muchos jobs independientes de ~1 us (overhead del scheduler)
+ * - grafo con dependencias: cadenas de jobs encadenados en paralelo
+ *
+ * El speedup se calcula contra la versión secuencial en un solo thread.
+ * El thread que llama también ejecuta jobs mientras espera.
+ *
+ * Uso: bench_job_system [repeticiones]
+ */
+
+#include "utils/JobSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+volatile double g_sink = 0.0;
+
+/**
+ * @brief Trabajo sintético de costo proporcional a iterations
+ */
+double work(size_t seed, int iterations) {
+    double acc = static_cast<double>(seed);
+    for (int i = 0; i < iterations; i++) {
+        acc = std::sin(acc) * 1.0001 + 0.5;
+    }
+    return acc;
+}
+
+template <typename Fn>
+double medianMs(int repetitions, Fn&& fn) {
+    std::vector<double> times;
+    fn();  // Calentamiento
+    for (int rep = 0; rep < repetitions; rep++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+constexpr size_t FOR_ITEMS = 4096;
+constexpr int FOR_ITERATIONS = 2000;   ///< ~20-40 us por ítem
+constexpr size_t SMALL_JOBS = 20000;
+constexpr int SMALL_ITERATIONS = 50;   ///< ~1 us por job
+constexpr int CHAINS = 64;
+constexpr int CHAIN_LENGTH = 32;
+constexpr int CHAIN_ITERATIONS = 1000;
+
+void uniformFor(JobSystem* jobs) {
+    std::vector<double> out(FOR_ITEMS);
+    auto body = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) out[i] = work(i, FOR_ITERATIONS);
+    };
+    if (jobs) jobs->parallelFor(0, FOR_ITEMS, 16, body);
+    else body(0, FOR_ITEMS);
+    g_sink = g_sink + out[FOR_ITEMS / 2];
+}
+
+void skewedFor(JobSystem* jobs) {
+    std::vector<double> out(FOR_ITEMS);
+    auto body = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            out[i] = work(i, static_cast<int>(FOR_ITERATIONS * 2 * i / FOR_ITEMS));
+        }
+    };
+    if (jobs) jobs->parallelFor(0, FOR_ITEMS, 16, body);
+    else body(0, FOR_ITEMS);
+    g_sink = g_sink + out[FOR_ITEMS - 1];
+}
+
+void smallJobs(JobSystem* jobs) {
+    std::vector<double> out(SMALL_JOBS);
+    if (!jobs) {
+        for (size_t i = 0; i < SMALL_JOBS; i++) out[i] = work(i, SMALL_ITERATIONS);
+    } else {
+        std::vector<JobHandle> handles;
+        handles.reserve(SMALL_JOBS);
+        for (size_t i = 0; i < SMALL_JOBS; i++) {
+            handles.push_back(jobs->schedule([&out, i] { out[i] = work(i, SMALL_ITERATIONS); }));
+        }
+        jobs->waitAll(handles);
+    }
+    g_sink = g_sink + out[0];
+}
+
+void dependencyChains(JobSystem* jobs) {
+    std::vector<double> state(CHAINS, 0.0);
+    if (!jobs) {
+        for (int c = 0; c < CHAINS; c++) {
+            for (int step = 0; step < CHAIN_LENGTH; step++) state[c] = work(static_cast<size_t>(state[c]), CHAIN_ITERATIONS);
+        }
+    } else {
+        // Cada eslabón depende del anterior de su cadena: solo CHAINS jobs listos a la vez
+        std::vector<JobHandle> tails(CHAINS);
+        for (int step = 0; step < CHAIN_LENGTH; step++) {
+            for (int c = 0; c < CHAINS; c++) {
+                tails[c] = jobs->schedule([&state, c] {
+                    state[c] = work(static_cast<size_t>(state[c]), CHAIN_ITERATIONS);
+                }, {tails[c]});
+            }
+        }
+        jobs->waitAll(tails);
+    }
+    g_sink = g_sink + state[0];
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int repetitions = (argc > 1) ? std::atoi(argv[1]) : 7;
+    if (repetitions < 1) repetitions = 1;
+
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    // 1, 2, 4... workers y por último todos los núcleos
+    std::vector<unsigned> workerCounts;
+    for (unsigned workers = 1; workers < cores; workers *= 2) {
+        workerCounts.push_back(workers);
+    }
+    workerCounts.push_back(cores);
+
+    struct Case {
+        const char* name;
+        void (*run)(JobSystem*);
+    };
+    const Case cases[] = {
+        {"parallel_for", uniformFor},
+        {"parallel_for skewed", skewedFor},
+        {"small jobs (20k)", smallJobs},
+        {"dependency chains", dependencyChains},
+    };
+
+    std::printf("=== Benchmark: escalado del JobSystem (mediana de %d repeticiones, %u núcleos) ===\n",
+                repetitions, cores);
+
+    for (const Case& c : cases) {
+        const double serialMs = medianMs(repetitions, [&] { c.run(nullptr); });
+        std::printf("\n%s\n  secuencial        %9.2f ms\n", c.name, serialMs);
+
+        for (unsigned workers : workerCounts) {
+            JobSystem jobs(workers);
+            const uint64_t stealsBefore = jobs.getStealCount();
+            const double ms = medianMs(repetitions, [&] { c.run(&jobs); });
+            std::printf("  %2u workers        %9.2f ms  x%.2f  (robos: %llu)\n", workers, ms, serialMs / ms,
+                        static_cast<unsigned long long>(jobs.getStealCount() - stealsBefore));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file bench_steady_allocs.cpp
+ * @brief Verifica que el camino de chunks del frame no reserva heap en régimen estable
+ *
+ * Recorre con la cámara un circuito de posiciones y, en cada paso, hace lo
+ * que Game hace por frame con el World:
+ * - World::setVisibleRegion con el diamante visible
+ * - World::getChunks (solo pedido) con el diamante de carga
+ * - World::processCompletedChunks y World::updateVisibleSet
+ * - World::getChunks con salida sobre un vector reutilizado
+ *
+ * Primero calienta hasta que todo el circuito está cargado y la FrameArena
+ * se estabilizó; después mide vueltas completas con AllocationCounter
+ * (reservas del thread principal). Termina con código 1 si algún paso reservó.
+ *
+ * Uso: bench_steady_allocs [vueltas]
+ */
+
+#include "core/World.hpp"
+#include "core/Camera.hpp"
+#include "utils/AllocationCounter.hpp"
+#include "utils/FrameArena.hpp"
+#include "utils/JobSystem.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t SEED = 12345;
+constexpr int SCREEN_WIDTH = 1280;
+constexpr int SCREEN_HEIGHT = 720;
+constexpr int MAX_RADIUS = 20;     ///< Como Game::MAX_RENDER_RADIUS
+constexpr int LOAD_MARGIN = 1;     ///< Como Game::LOAD_MARGIN
+constexpr int WARMUP_LAPS = 3;     ///< Vueltas extra con todo cargado antes de medir
+constexpr int MAX_WARMUP_STEPS = 100000;
+
+/** @brief Circuito de la cámara (bloques): cruza bordes de chunk en X y en Z */
+constexpr float PATH[][2] = {{0.0f, 0.0f}, {12.0f, 0.0f}, {12.0f, 12.0f}, {0.0f, 12.0f}};
+constexpr int PATH_LENGTH = static_cast<int>(sizeof(PATH) / sizeof(PATH[0]));
+
+struct Regions {
+    std::vector<ChunkPos> visible;
+    std::vector<ChunkPos> load;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int laps = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 20;
+
+    JobSystem::instance();
+    World world(SEED);
+    Camera camera;
+    camera.setZoom(2.0f);
+    camera.setCenter(SCREEN_WIDTH / 2.0f, SCREEN_HEIGHT / 2.0f);
+
+    // Regiones precalculadas: la cámara no es parte de lo que se mide
+    std::vector<Regions> regions(PATH_LENGTH);
+    for (int i = 0; i < PATH_LENGTH; i++) {
+        const int height = world.getTerrainHeight(static_cast<int>(PATH[i][0]), static_cast<int>(PATH[i][1])) + 1;
+        camera.setPosition(PATH[i][0], static_cast<float>(height), PATH[i][1]);
+        camera.getVisibleChunks(SCREEN_WIDTH, SCREEN_HEIGHT, 1, MAX_RADIUS, regions[i].visible);
+        camera.getVisibleChunks(SCREEN_WIDTH, SCREEN_HEIGHT, LOAD_MARGIN, MAX_RADIUS + LOAD_MARGIN,
+                                regions[i].load);
+    }
+
+    std::vector<Chunk*> chunks;
+    auto step = [&](const Regions& region) {
+        FrameArena::instance().reset();
+        world.setVisibleRegion(region.visible);
+        world.getChunks(region.load);
+        world.processCompletedChunks(4.0);
+        world.updateVisibleSet();
+        world.getChunks(region.visible, chunks);
+    };
+
+    // Calentamiento: hasta que todo el circuito esté publicado
+    const auto warmupStart = std::chrono::steady_clock::now();
+    int warmupSteps = 0;
+    for (bool loaded = false; !loaded && warmupSteps < MAX_WARMUP_STEPS; warmupSteps++) {
+        step(regions[warmupSteps % PATH_LENGTH]);
+        if (!JobSystem::instance().runWorkerJob()) {
+            std::this_thread::yield();
+        }
+        loaded = warmupSteps % PATH_LENGTH == PATH_LENGTH - 1 &&
+                 world.getPendingGenerationCount() == 0 && world.getVisibleMissingCount() == 0;
+    }
+    for (int i = 0; i < WARMUP_LAPS * PATH_LENGTH; i++) {
+        step(regions[i % PATH_LENGTH]);
+    }
+    const double warmupMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - warmupStart).count();
+    std::printf("Calentamiento: %d pasos, %.1f ms, %zu chunks cargados\n",
+                warmupSteps, warmupMs, world.getChunkCount());
+
+    // Medición: reservas por paso en el thread principal
+    int failedSteps = 0;
+    uint64_t maxPerStep = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < laps * PATH_LENGTH; i++) {
+        const uint64_t before = AllocationCounter::getThreadAllocations();
+        step(regions[i % PATH_LENGTH]);
+        const uint64_t allocations = AllocationCounter::getThreadAllocations() - before;
+        if (allocations > 0) {
+            failedSteps++;
+            maxPerStep = std::max(maxPerStep, allocations);
+        }
+    }
+    const double elapsedUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::printf("Pasos medidos: %d (%.2f us/paso), con reservas: %d (máximo %llu por paso)\n",
+                laps * PATH_LENGTH, elapsedUs / (laps * PATH_LENGTH), failedSteps,
+                static_cast<unsigned long long>(maxPerStep));
+    return failedSteps == 0 ? 0 : 1;
+}
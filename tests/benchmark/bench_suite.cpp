@@ -0,0 +1,459 @@
+/**
+ * @file bench_suite.cpp
+ * @brief Suite de microbenchmarks de los caminos calientes, con salida JSON
+ *
+ * Mide cada camino caliente aislado, sin ventana ni SDL:
+ * - generate_chunk: World::generateChunk (generateTerrain + pool) por chunk
+ * - chunk_get_block / chunk_set_block: acceso con validación a un Chunk
+ * - world_get_block_seq / world_get_block_random: World::getBlock sobre un área generada
+ * - tile_list_build: la lista de tiles de renderWorld sobre un conjunto fijo de chunks
+ * - depth_sort: TileDepthSorter sobre esa lista
+ * - world_to_screen: Camera::worldToScreen
+ * - get_chunks_around: World::getChunksAround (radio 10, todo generado)
+ * - chunk_compress / chunk_decompress: ChunkCodec (tier frío) sobre chunks del área
+ *
+ * Cada benchmark hace una repetición de calentamiento y N repeticiones
+ * medidas. El JSON (nombres y orden fijos) reporta ns por operación:
+ * media, mediana, desviación estándar, mínimo y máximo.
+ *
+ * Con --baseline se comparan las medianas contra un JSON guardado y el
+ * proceso termina con código 1 si alguna empeora más que --threshold.
+ *
+ * Uso: bench_suite [--reps N] [--out archivo.json] [--baseline archivo.json] [--threshold 0.10]
+ */
+
+#include "core/World.hpp"
+#include "core/Camera.hpp"
+#include "core/ChunkCodec.hpp"
+#include "rendering/RenderTiles.hpp"
+#include "rendering/TileListBuilder.hpp"
+#include "utils/FrameArena.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t SEED = 12345;
+constexpr int SCREEN_WIDTH = 1280;
+constexpr int SCREEN_HEIGHT = 720;
+constexpr int AREA_RADIUS = 10;  ///< Radio (chunks) del área pre-generada alrededor del origen
+
+/**
+ * @brief Evita que el compilador elimine el trabajo medido
+ */
+volatile int64_t g_sink = 0;
+
+struct BenchResult {
+    std::string name;
+    size_t opsPerRep = 0;
+    double mean = 0.0;
+    double median = 0.0;
+    double stddev = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * @brief Ejecuta un benchmark
+ * @param name Nombre estable (clave en el JSON)
+ * @param opsPerRep Operaciones por repetición (para normalizar a ns/op)
+ * @param repetitions Repeticiones medidas
+ * @param body Trabajo medido de una repetición
+ * @param reset Preparación entre repeticiones (fuera del tiempo medido)
+ */
+BenchResult runBench(const char* name, size_t opsPerRep, int repetitions,
+                     const std::function<void(int)>& body,
+                     const std::function<void(int)>& reset = nullptr) {
+    std::fprintf(stderr, "  %-24s", name);
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+
+    // Repetición -1: calentamiento (caches, pools, capacidad de vectores)
+    for (int rep = -1; rep < repetitions; rep++) {
+        if (reset) reset(rep);
+        auto start = std::chrono::steady_clock::now();
+        body(rep);
+        auto end = std::chrono::steady_clock::now();
+        if (rep >= 0) {
+            double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            samples.push_back(ns / static_cast<double>(opsPerRep));
+        }
+    }
+
+    BenchResult result;
+    result.name = name;
+    result.opsPerRep = opsPerRep;
+
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double s : samples) sum += s;
+    result.mean = sum / samples.size();
+    result.median = (samples.size() % 2) ? samples[samples.size() / 2]
+        : 0.5 * (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]);
+    double variance = 0.0;
+    for (double s : samples) variance += (s - result.mean) * (s - result.mean);
+    result.stddev = std::sqrt(variance / samples.size());
+    result.min = samples.front();
+    result.max = samples.back();
+
+    std::fprintf(stderr, "%12.3f ns/op (±%.1f%%)\n", result.median,
+                 result.mean > 0.0 ? 100.0 * result.stddev / result.mean : 0.0);
+    return result;
+}
+
+void writeJson(const std::vector<BenchResult>& results, int repetitions, std::ostream& out) {
+    char line[512];
+    out << "{\n";
+    out << "  \"suite\": \"hot_paths\",\n";
+    std::snprintf(line, sizeof(line), "  \"seed\": %u,\n  \"repetitions\": %d,\n", SEED, repetitions);
+    out << line;
+    out << "  \"unit\": \"ns_per_op\",\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        std::snprintf(line, sizeof(line),
+            "    {\"name\": \"%s\", \"ops_per_rep\": %zu, \"mean\": %.3f, \"median\": %.3f, "
+            "\"stddev\": %.3f, \"min\": %.3f, \"max\": %.3f}%s\n",
+            r.name.c_str(), r.opsPerRep, r.mean, r.median, r.stddev, r.min, r.max,
+            (i + 1 < results.size()) ? "," : "");
+        out << line;
+    }
+    out << "  ]\n}\n";
+}
+
+/**
+ * @brief Lee la mediana de un benchmark de un JSON escrito por writeJson
+ * @return false si el benchmark no está en el baseline
+ */
+bool findBaselineMedian(const std::string& json, const std::string& name, double& median) {
+    const std::string key = "\"name\": \"" + name + "\"";
+    size_t pos = json.find(key);
+    if (pos == std::string::npos) return false;
+    const size_t objectEnd = json.find('}', pos);
+    pos = json.find("\"median\":", pos);
+    if (pos == std::string::npos || pos > objectEnd) return false;
+    median = std::strtod(json.c_str() + pos + std::strlen("\"median\":"), nullptr);
+    return true;
+}
+
+/**
+ * @brief Compara contra el baseline
+ * @return Cantidad de regresiones por encima del umbral
+ */
+int compareWithBaseline(const std::vector<BenchResult>& results, const std::string& path, double threshold) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "ERROR: no se pudo abrir el baseline %s\n", path.c_str());
+        return -1;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string json = buffer.str();
+
+    int regressions = 0;
+    std::fprintf(stderr, "\n=== Comparación con %s (umbral %.0f%%) ===\n", path.c_str(), threshold * 100.0);
+    for (const BenchResult& r : results) {
+        double baseline = 0.0;
+        if (!findBaselineMedian(json, r.name, baseline) || baseline <= 0.0) {
+            std::fprintf(stderr, "  %-24s (sin baseline)\n", r.name.c_str());
+            continue;
+        }
+        const double change = r.median / baseline - 1.0;
+        const bool regression = change > threshold;
+        if (regression) regressions++;
+        std::fprintf(stderr, "  %-24s %12.3f -> %12.3f ns/op  %+6.1f%%%s\n", r.name.c_str(),
+                     baseline, r.median, change * 100.0, regression ? "  REGRESIÓN" : "");
+    }
+    return regressions;
+}
+
+/**
+ * @brief Sitúa la cámara sobre el centro de un chunk como lo hace el Game
+ */
+void placeCamera(Camera& camera, const World& world, ChunkPos chunk) {
+    const int x = chunk.x * BlockConfig::CHUNK_SIZE + BlockConfig::CHUNK_SIZE / 2;
+    const int z = chunk.z * BlockConfig::CHUNK_SIZE + BlockConfig::CHUNK_SIZE / 2;
+    camera.setCenter(SCREEN_WIDTH * 0.5f, SCREEN_HEIGHT * 0.5f);
+    camera.setZoom(1.0f);
+    camera.setPosition(static_cast<float>(x), static_cast<float>(world.getTerrainHeight(x, z)),
+                       static_cast<float>(z));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int repetitions = 15;
+    std::string outPath;
+    std::string baselinePath;
+    double threshold = 0.10;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if (arg == "--reps" && hasValue) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--out" && hasValue) {
+            outPath = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            baselinePath = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            threshold = std::atof(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Uso: %s [--reps N] [--out archivo.json] [--baseline archivo.json] [--threshold 0.10]\n",
+                         argv[0]);
+            return arg == "--help" ? 0 : 2;
+        }
+    }
+
+    std::fprintf(stderr, "=== Microbenchmarks (mediana de %d repeticiones) ===\n", repetitions);
+
+    // Mundo con semilla fija. Los chunks se generan en este thread con
+    // generateChunk, así el thread de background no interviene.
+    World world(SEED);
+    for (int x = -AREA_RADIUS; x <= AREA_RADIUS; x++) {
+        for (int z = -AREA_RADIUS; z <= AREA_RADIUS; z++) {
+            world.generateChunk(ChunkPos(x, z));
+        }
+    }
+
+    std::vector<BenchResult> results;
+
+    // ------------------------------------------------------------------
+    // Generación de terreno: chunks nuevos lejos del área fija en cada
+    // repetición, devueltos al pool después (fuera del tiempo medido)
+    // ------------------------------------------------------------------
+    const int generationSide = 8;
+    results.push_back(runBench("generate_chunk", generationSide * generationSide, repetitions,
+        [&](int rep) {
+            const int baseX = 1000 + (rep + 1) * generationSide;
+            for (int x = 0; x < generationSide; x++) {
+                for (int z = 0; z < generationSide; z++) {
+                    world.generateChunk(ChunkPos(baseX + x, 1000 + z));
+                }
+            }
+        },
+        [&](int) { world.unloadChunksFarFrom(ChunkPos(0, 0), AREA_RADIUS); }));
+    world.unloadChunksFarFrom(ChunkPos(0, 0), AREA_RADIUS);
+
+    // ------------------------------------------------------------------
+    // Acceso a bloques de un chunk (con validación de rango)
+    // ------------------------------------------------------------------
+    const size_t blocksPerChunk = BlockConfig::CHUNK_SIZE * BlockConfig::CHUNK_SIZE * BlockConfig::WORLD_HEIGHT;
+    const int chunkPasses = 64;
+    const Chunk* sampleChunk = world.getChunk(ChunkPos(0, 0));
+
+    results.push_back(runBench("chunk_get_block", blocksPerChunk * chunkPasses, repetitions, [&](int) {
+        int64_t sum = 0;
+        for (int pass = 0; pass < chunkPasses; pass++) {
+            for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+                for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+                    for (int y = 0; y < BlockConfig::WORLD_HEIGHT; y++) {
+                        sum += static_cast<int>(sampleChunk->getBlock(x, y, z).type);
+                    }
+                }
+            }
+        }
+        g_sink = g_sink + sum;
+    }));
+
+    Chunk scratchChunk(ChunkPos(0, 0));
+    results.push_back(runBench("chunk_set_block", blocksPerChunk * chunkPasses, repetitions, [&](int) {
+        for (int pass = 0; pass < chunkPasses; pass++) {
+            const BlockType type = (pass & 1) ? BlockType::PIEDRA : BlockType::AIRE;
+            for (int x = 0; x < BlockConfig::CHUNK_SIZE; x++) {
+                for (int z = 0; z < BlockConfig::CHUNK_SIZE; z++) {
+                    for (int y = 0; y < BlockConfig::WORLD_HEIGHT; y++) {
+                        scratchChunk.setBlock(x, y, z, type);
+                    }
+                }
+            }
+        }
+        g_sink = g_sink + static_cast<int>(scratchChunk.getBlock(0, 0, 0).type);
+    }));
+
+    // ------------------------------------------------------------------
+    // World::getBlock: recorrido secuencial y aleatorio del área generada
+    // ------------------------------------------------------------------
+    const int areaMin = -AREA_RADIUS * BlockConfig::CHUNK_SIZE;
+    const int areaSide = (AREA_RADIUS * 2 + 1) * BlockConfig::CHUNK_SIZE;
+    const World& constWorld = world;
+
+    results.push_back(runBench("world_get_block_seq",
+        static_cast<size_t>(areaSide) * areaSide * BlockConfig::WORLD_HEIGHT, repetitions, [&](int) {
+        int64_t sum = 0;
+        for (int x = areaMin; x < areaMin + areaSide; x++) {
+            for (int z = areaMin; z < areaMin + areaSide; z++) {
+                for (int y = 0; y < BlockConfig::WORLD_HEIGHT; y++) {
+                    sum += static_cast<int>(constWorld.getBlock(x, y, z).type);
+                }
+            }
+        }
+        g_sink = g_sink + sum;
+    }));
+
+    const size_t randomCount = 1 << 18;
+    std::vector<int32_t> randomCoords(randomCount * 3);
+    {
+        std::mt19937 rng(SEED);
+        std::uniform_int_distribution<int> horizontal(areaMin, areaMin + areaSide - 1);
+        std::uniform_int_distribution<int> vertical(0, BlockConfig::WORLD_HEIGHT - 1);
+        for (size_t i = 0; i < randomCount; i++) {
+            randomCoords[i * 3 + 0] = horizontal(rng);
+            randomCoords[i * 3 + 1] = vertical(rng);
+            randomCoords[i * 3 + 2] = horizontal(rng);
+        }
+    }
+    results.push_back(runBench("world_get_block_random", randomCount, repetitions, [&](int) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < randomCount; i++) {
+            sum += static_cast<int>(constWorld.getBlock(randomCoords[i * 3], randomCoords[i * 3 + 1],
+                                                        randomCoords[i * 3 + 2]).type);
+        }
+        g_sink = g_sink + sum;
+    }));
+
+    // ------------------------------------------------------------------
+    // Lista de tiles de renderWorld sobre un conjunto fijo de chunks
+    // (cámara en el centro del área, zoom 1, 1280x720)
+    // ------------------------------------------------------------------
+    Camera camera;
+    placeCamera(camera, world, ChunkPos(0, 0));
+
+    std::vector<ChunkPos> visiblePositions;
+    camera.getVisibleChunks(SCREEN_WIDTH, SCREEN_HEIGHT, 1, AREA_RADIUS, visiblePositions);
+    std::vector<Chunk*> visibleChunks;
+    for (const ChunkPos& pos : visiblePositions) {
+        if (Chunk* chunk = world.getChunk(pos)) {
+            visibleChunks.push_back(chunk);
+        }
+    }
+    const std::vector<const ImpostorChunk*> noImpostors;
+
+    TileList tiles;
+    TileListStats stats;
+    TileListBuilder::build(visibleChunks, noImpostors, camera, SCREEN_WIDTH, SCREEN_HEIGHT, tiles, stats);
+    std::fprintf(stderr, "  (conjunto fijo: %zu chunks, %zu tiles)\n", visibleChunks.size(), tiles.size());
+
+    results.push_back(runBench("tile_list_build", visibleChunks.size(), repetitions, [&](int) {
+        TileListBuilder::build(visibleChunks, noImpostors, camera, SCREEN_WIDTH, SCREEN_HEIGHT, tiles, stats);
+        g_sink = g_sink + static_cast<int64_t>(tiles.size());
+    }));
+
+    TileDepthSorter sorter;
+    results.push_back(runBench("depth_sort", std::max<size_t>(tiles.size(), 1), repetitions, [&](int) {
+        const std::vector<uint32_t>& order = sorter.sort(tiles.depth.data(), tiles.size());
+        g_sink = g_sink + (order.empty() ? 0 : order.front());
+    }));
+
+    // ------------------------------------------------------------------
+    // Proyección isométrica
+    // ------------------------------------------------------------------
+    const int projectionSide = 256;
+    results.push_back(runBench("world_to_screen",
+        static_cast<size_t>(projectionSide) * projectionSide * 4, repetitions, [&](int) {
+        float acc = 0.0f;
+        for (int x = 0; x < projectionSide; x++) {
+            for (int z = 0; z < projectionSide; z++) {
+                for (int y = 0; y < 4; y++) {
+                    float sx, sy;
+                    camera.worldToScreen(static_cast<float>(x), static_cast<float>(y * 8),
+                                         static_cast<float>(z), sx, sy);
+                    acc += sx + sy;
+                }
+            }
+        }
+        g_sink = g_sink + static_cast<int64_t>(acc);
+    }));
+
+    // ------------------------------------------------------------------
+    // getChunksAround: todo el radio ya está generado (solo lookup)
+    // ------------------------------------------------------------------
+    const int lookupCalls = 16;
+    const size_t chunksPerCall = (AREA_RADIUS * 2 + 1) * (AREA_RADIUS * 2 + 1);
+    std::vector<Chunk*> aroundChunks;
+    results.push_back(runBench("get_chunks_around", chunksPerCall * lookupCalls, repetitions, [&](int) {
+        size_t found = 0;
+        for (int call = 0; call < lookupCalls; call++) {
+            FrameArena::instance().reset();  // Como al inicio de cada frame del juego
+            world.getChunksAround(ChunkPos(0, 0), AREA_RADIUS, aroundChunks);
+            found += aroundChunks.size();
+        }
+        g_sink = g_sink + static_cast<int64_t>(found);
+    }));
+
+    // ------------------------------------------------------------------
+    // Tier frío: comprimir y expandir chunks reales del área
+    // ------------------------------------------------------------------
+    const int codecSide = 8;
+    std::vector<const Chunk*> codecChunks;
+    for (int x = 0; x < codecSide; x++) {
+        for (int z = 0; z < codecSide; z++) {
+            codecChunks.push_back(world.getChunk(ChunkPos(x - codecSide / 2, z - codecSide / 2)));
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> compressedChunks(codecChunks.size());
+    results.push_back(runBench("chunk_compress", codecChunks.size(), repetitions, [&](int) {
+        for (size_t i = 0; i < codecChunks.size(); i++) {
+            ChunkCodec::compress(*codecChunks[i], compressedChunks[i]);
+        }
+        g_sink = g_sink + static_cast<int64_t>(compressedChunks[0].size());
+    }));
+
+    size_t compressedBytes = 0;
+    size_t expandedBytes = 0;
+    for (size_t i = 0; i < codecChunks.size(); i++) {
+        compressedBytes += compressedChunks[i].size();
+        expandedBytes += codecChunks[i]->getResidentBytes();
+    }
+    std::fprintf(stderr, "  chunk_codec: %.0f bytes/chunk comprimido, %.0f expandido (%.1fx)\n",
+                 static_cast<double>(compressedBytes) / codecChunks.size(),
+                 static_cast<double>(expandedBytes) / codecChunks.size(),
+                 compressedBytes ? static_cast<double>(expandedBytes) / compressedBytes : 0.0);
+
+    results.push_back(runBench("chunk_decompress", codecChunks.size(), repetitions, [&](int) {
+        for (const std::vector<uint8_t>& data : compressedChunks) {
+            scratchChunk.clear();
+            ChunkCodec::decompress(data.data(), data.size(), scratchChunk);
+        }
+        g_sink = g_sink + scratchChunk.getMaxHeight();
+    }));
+
+    // ------------------------------------------------------------------
+    // Salida
+    // ------------------------------------------------------------------
+    if (outPath.empty()) {
+        std::ostringstream json;
+        writeJson(results, repetitions, json);
+        std::fputs(json.str().c_str(), stdout);
+    } else {
+        std::ofstream file(outPath);
+        if (!file.is_open()) {
+            std::fprintf(stderr, "ERROR: no se pudo escribir %s\n", outPath.c_str());
+            return 2;
+        }
+        writeJson(results, repetitions, file);
+        std::fprintf(stderr, "Resultados en %s\n", outPath.c_str());
+    }
+
+    if (!baselinePath.empty()) {
+        const int regressions = compareWithBaseline(results, baselinePath, threshold);
+        if (regressions < 0) return 2;
+        if (regressions > 0) {
+            std::fprintf(stderr, "%d regresión(es) por encima del umbral\n", regressions);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file bench_tile_sort.cpp
+ * @brief Benchmark del depth sort de tiles: AoS legacy vs SoA key/index
+ *
+ * Compara el radix sort anterior (structs RenderTile completos, 4 pasadas
+ * fijas, buffer temporal por llamada) con TileDepthSorter (pares clave/índice,
+ * pasadas según el rango real, buffers persistentes) a 50k y 200k tiles.
+ *
+ * Los tiles se generan como en renderWorld: columnas de un área de chunks
+ * con varias capas bajo la superficie, en el orden chunk -> x -> z -> y.
+ *
+ * Uso: bench_tile_sort [repeticiones]
+ */
+
+#include "rendering/RenderTiles.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Copia del RenderTile AoS anterior (referencia del benchmark)
+ */
+struct LegacyTile {
+    float x, y;
+    BlockType type;
+    int worldY;
+    int worldX, worldZ;
+    bool isPlayer;
+};
+
+/**
+ * @brief Radix sort anterior: 4 pasadas de 8 bits moviendo structs completos
+ */
+void legacyRadixSort(std::vector<LegacyTile>& tiles) {
+    if (tiles.size() <= 1) return;
+
+    std::vector<LegacyTile> temp(tiles.size());
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        size_t count[256] = {0};
+
+        for (size_t i = 0; i < tiles.size(); i++) {
+            int depth = tiles[i].worldX + tiles[i].worldZ + tiles[i].worldY * 2;
+            uint32_t signedDepth = static_cast<uint32_t>(depth) ^ 0x80000000;
+            count[(signedDepth >> shift) & 0xFF]++;
+        }
+
+        size_t total = 0;
+        for (int i = 0; i < 256; i++) {
+            size_t oldCount = count[i];
+            count[i] = total;
+            total += oldCount;
+        }
+
+        for (size_t i = 0; i < tiles.size(); i++) {
+            int depth = tiles[i].worldX + tiles[i].worldZ + tiles[i].worldY * 2;
+            uint32_t signedDepth = static_cast<uint32_t>(depth) ^ 0x80000000;
+            temp[count[(signedDepth >> shift) & 0xFF]++] = tiles[i];
+        }
+
+        std::swap(tiles, temp);
+    }
+}
+
+/**
+ * @brief Genera tiles con la distribución de renderWorld
+ * @param count Cantidad de tiles
+ * @param out Tiles AoS de salida
+ */
+void generateTiles(size_t count, std::vector<LegacyTile>& out) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> heightDist(3, 28);
+
+    out.clear();
+    out.reserve(count);
+
+    // Área cuadrada de chunks centrada en el origen con ~6 capas por columna
+    const int layers = 6;
+    const int columns = static_cast<int>((count + layers - 1) / layers);
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(columns))));
+    const int chunkSide = (side + BlockConfig::CHUNK_SIZE - 1) / BlockConfig::CHUNK_SIZE;
+    const int half = chunkSide / 2;
+
+    for (int cx = -half; cx < chunkSide - half && out.size() < count; cx++) {
+        for (int cz = -half; cz < chunkSide - half && out.size() < count; cz++) {
+            for (int x = 0; x < BlockConfig::CHUNK_SIZE && out.size() < count; x++) {
+                for (int z = 0; z < BlockConfig::CHUNK_SIZE && out.size() < count; z++) {
+                    int surface = heightDist(rng);
+                    for (int y = surface - layers + 1; y <= surface && out.size() < count; y++) {
+                        LegacyTile tile{};
+                        tile.worldX = cx * BlockConfig::CHUNK_SIZE + x;
+                        tile.worldZ = cz * BlockConfig::CHUNK_SIZE + z;
+                        tile.worldY = y;
+                        tile.x = static_cast<float>((tile.worldX - tile.worldZ) * 16);
+                        tile.y = static_cast<float>((tile.worldX + tile.worldZ) * 8 - y * 16);
+                        tile.type = BlockType::PIEDRA;
+                        out.push_back(tile);
+                    }
+                }
+            }
+        }
+    }
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void runCase(size_t tileCount, int repetitions) {
+    std::vector<LegacyTile> source;
+    generateTiles(tileCount, source);
+
+    TileList list;
+    list.reserve(source.size());
+    for (const LegacyTile& t : source) {
+        list.push(t.x, t.y, t.type, 0, t.worldX, t.worldY, t.worldZ);
+    }
+
+    TileDepthSorter sorter;
+    std::vector<LegacyTile> legacy;
+    legacy.reserve(source.size());
+
+    std::vector<double> legacyTimes;
+    std::vector<double> soaTimes;
+
+    for (int rep = 0; rep < repetitions; rep++) {
+        // Restaurar la entrada desordenada (fuera del tiempo medido)
+        legacy.assign(source.begin(), source.end());
+        auto start = std::chrono::high_resolution_clock::now();
+        legacyRadixSort(legacy);
+        auto end = std::chrono::high_resolution_clock::now();
+        legacyTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+        start = std::chrono::high_resolution_clock::now();
+        const std::vector<uint32_t>& order = sorter.sort(list.depth.data(), list.size());
+        end = std::chrono::high_resolution_clock::now();
+        soaTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+        // Verificar que ambos producen el mismo orden (ambos son estables)
+        if (rep == 0) {
+            for (size_t i = 0; i < order.size(); i++) {
+                const LegacyTile& a = legacy[i];
+                const LegacyTile& b = source[order[i]];
+                if (a.worldX != b.worldX || a.worldY != b.worldY || a.worldZ != b.worldZ) {
+                    std::printf("ERROR: orden distinto en la posición %zu\n", i);
+                    std::exit(1);
+                }
+            }
+        }
+    }
+
+    double legacyMedian = median(legacyTimes);
+    double soaMedian = median(soaTimes);
+    std::printf("%7zu tiles | legacy AoS: %9.1f us | SoA key/index: %9.1f us (%d pasadas) | x%.2f\n",
+                list.size(), legacyMedian, soaMedian, sorter.getLastPassCount(),
+                legacyMedian / soaMedian);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int repetitions = (argc > 1) ? std::atoi(argv[1]) : 50;
+    if (repetitions < 1) repetitions = 1;
+
+    std::printf("=== Benchmark: depth sort de tiles (mediana de %d repeticiones) ===\n", repetitions);
+    runCase(50000, repetitions);
+    runCase(200000, repetitions);
+    return 0;
+}